@@ -73,6 +73,7 @@ namespace py = pybind11;
 #include "util.h"
 #include "datareader.h"
 #include "oofemtxtdatareader.h"
+#include "oofembindatareader.h"
 #include "valuemodetype.h"
 #include "dofiditem.h"
 #include "timer.h"
@@ -697,6 +698,11 @@ PYBIND11_MODULE(oofempy, m) {
         .def(py::init<std::string>())
     ;
 
+    py::class_<oofem::OOFEMBinDataReader, oofem::DataReader>(m, "OOFEMBinDataReader")
+        .def(py::init<std::string>())
+        .def_static("convert", &oofem::OOFEMBinDataReader::convert)
+    ;
+
 
     py::class_<oofem::InputRecord>(m, "InputRecord")
     ;
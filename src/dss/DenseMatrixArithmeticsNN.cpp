@@ -138,15 +138,19 @@ void DenseMatrixArithmetics :: MultDiagonalBlockByVector(double *B, double *x, d
 // This is the most SPARSEDIRECT SOLVER innerloop operation
 void DenseMatrixArithmetics :: SubATBproduct(double *pC, double *pA, double *pB)
 {
-    long i, j, k;
-    for ( j = 0; j < bn; j++, pA -= bnbn, pB += bn ) {
-        for ( i = 0; i < bn; i++, pC++, pB -= bn ) {
-            tmp = 0;
-            for ( k = 0; k < bn; k++, pA++, pB++ ) {
-                tmp += * pA * ( * pB );
+    for ( long j = 0; j < bn; j++ ) {
+        const double *b = pB + j * bn;
+        for ( long i = 0; i < bn; i++ ) {
+            const double *a = pA + i * bn;
+            double sum = 0.;
+#ifdef _OPENMP
+#pragma omp simd reduction(+:sum)
+#endif
+            for ( long k = 0; k < bn; k++ ) {
+                sum += a [ k ] * b [ k ];
             }
 
-            * pC -= tmp;
+            pC [ i + j * bn ] -= sum;
         }
     }
 }
@@ -179,6 +183,9 @@ void DenseMatrixArithmetics :: Cholesky_Decomposition(double *pC, double * &p)
                     p [ i ] = sqrt(sum);
                 } else {
                     p [ i ] = 1.0;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
                     DenseMatrixArithmetics :: zero_pivots++;
                 }
             } else   {
@@ -281,6 +288,9 @@ void DenseMatrixArithmetics :: LL_Decomposition(double *pC)
                 } else {
                     this->MT.Write("Matrix is not positive definite.");
                     a [ bn * i ] = 1.0;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
                     DenseMatrixArithmetics :: zero_pivots++;
                 }
             } else   {
@@ -402,6 +412,9 @@ void DenseMatrixArithmetics :: LU_Decomposition(double *C)
 
         if ( a [ j + n * j ] == 0.0 ) {
             a [ j + n * j ] = TINY;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
             DenseMatrixArithmetics :: zero_pivots++;
         } else   {
             a [ j + n * j ] = 1.0 / a [ j + n * j ]; //invert block
@@ -507,12 +520,23 @@ void DenseMatrixArithmetics :: LDL_Decomposition(double *A)
 
         if ( fabs(* Ajj) <= eMT->min_pivot ) {
             if ( eMT->stabil_pivot == 0.0 ) {
-                eMT->act_row = eMT->act_block + j;
-                if ( !eMT->CallUnstableDialog() ) {
+                bool proceed;
+                // the tracer is shared by the arithmetics of all threads
+#ifdef _OPENMP
+#pragma omp critical (dss_tracer)
+#endif
+                {
+                    eMT->act_row = eMT->act_block + j;
+                    proceed = eMT->CallUnstableDialog();
+                }
+                if ( !proceed ) {
                     return;
                 }
             }
 
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
             DenseMatrixArithmetics :: zero_pivots++;
             * Ajj = eMT->stabil_pivot;
         }
@@ -614,6 +638,9 @@ void DenseMatrixArithmetics1x1 :: GetInversion(double *pC, double *pA)
 void DenseMatrixArithmetics1x1 :: FactorizeBlock(double *A)
 {
     if ( * A == 0.0 ) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
         DenseMatrixArithmetics :: zero_pivots++;
         * A = 1.0;
     } else {
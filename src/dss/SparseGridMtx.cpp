@@ -34,6 +34,10 @@
 
 #include "SparseGridMtx.h"
 
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
+
 DSS_NAMESPASE_BEGIN
 
 // Allocates new space according to bskl and reads old matrix with respect
@@ -153,6 +157,129 @@ void SparseGridMtx :: WriteStatistics(long no_init_blocks, long no_nonzeros)
     eMT->Writeln("%% ");
 }
 
+long SparseGridMtx :: ComputeColumnLevels(long * &level_ptr, long * &level_columns)
+{
+    long *level = new long [ n_blocks ];
+    long n_levels = 0;
+
+    // pattern of column bj contains only preceding columns, their levels are known
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        SparseGridColumn &columnJ = * Columns [ bj ];
+        long *columnJentries = columnJ.IndexesUfa->Items;
+        long lev = 0;
+        for ( long idx = 0; idx < columnJ.Entries; idx++ ) {
+            lev = std :: max(lev, level [ columnJentries [ idx ] ] + 1);
+        }
+
+        level [ bj ] = lev;
+        n_levels = std :: max(n_levels, lev + 1);
+    }
+
+    level_ptr = new long [ n_levels + 1 ];
+    memset( level_ptr, 0, ( n_levels + 1 ) * sizeof( long ) );
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        level_ptr [ level [ bj ] + 1 ]++;
+    }
+
+    for ( long l = 0; l < n_levels; l++ ) {
+        level_ptr [ l + 1 ] += level_ptr [ l ];
+    }
+
+    long *pos = new long [ n_levels ];
+    memcpy( pos, level_ptr, n_levels * sizeof( long ) );
+    level_columns = new long [ n_blocks ];
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        level_columns [ pos [ level [ bj ] ]++ ] = bj;
+    }
+
+    delete [] pos;
+    delete [] level;
+    return n_levels;
+}
+
+void SparseGridMtx :: FactorizeColumns()
+{
+    eMT->act_block = 0;
+
+#ifdef _OPENMP
+    int nthreads = omp_get_max_threads();
+    if ( nthreads > 1 && n_blocks > 1 ) {
+        long *level_ptr, *level_columns;
+        long n_levels = ComputeColumnLevels(level_ptr, level_columns);
+
+        // The arithmetics keep temporaries, so each thread gets its own instance.
+        // They are created in advance, the constructor resets the zero pivot counter.
+        // Like the serial arithmetics, they report to the tracer of the receiver (pivot settings).
+        long zero_pivots = DenseMatrixArithmetics :: zero_pivots;
+        DenseMatrixArithmetics **arith = new DenseMatrixArithmetics * [ nthreads ];
+        for ( int t = 0; t < nthreads; t++ ) {
+            arith [ t ] = DenseMatrixArithmetics :: NewArithmetics(block_size);
+            arith [ t ]->eMT = eMT;
+        }
+        DenseMatrixArithmetics :: zero_pivots = zero_pivots;
+
+        // columns of the finished levels, the factorization stops after a level like the serial loop after a column
+        long n_done = 0;
+        bool stop = false;
+
+ #pragma omp parallel num_threads(nthreads)
+        {
+            int t = omp_get_thread_num();
+            long *p_blockJ_pattern = new long [ n_blocks + 1 ];
+            memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
+            double *Atmp = new double [ block_storage ];
+
+            for ( long l = 0; l < n_levels; l++ ) {
+                // implicit barrier at the end of the loop finishes the level
+ #pragma omp for schedule(dynamic, 1)
+                for ( long i = level_ptr [ l ]; i < level_ptr [ l + 1 ]; i++ ) {
+                    FactorizeColumn(level_columns [ i ], p_blockJ_pattern, Atmp, arith [ t ]);
+                }
+
+                // all threads see the same flag after the implicit barrier of single
+ #pragma omp single
+                {
+                    n_done = level_ptr [ l + 1 ];
+                    stop = eMT->break_flag != 0;
+                }
+                if ( stop ) {
+                    break;
+                }
+            }
+
+            delete [] p_blockJ_pattern;
+            delete [] Atmp;
+        }
+
+        for ( int t = 0; t < nthreads; t++ ) {
+            delete arith [ t ];
+        }
+        delete [] arith;
+        delete [] level_ptr;
+        delete [] level_columns;
+        eMT->act_block = n_done * block_size;
+        return;
+    }
+#endif
+
+    // This is a pattern of blocks in J-th column
+    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
+    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
+    double *Atmp = new double [ block_storage ];
+
+    for ( long bj = 0; bj < n_blocks; bj++ ) {
+        FactorizeColumn(bj, p_blockJ_pattern, Atmp, BlockArith);
+
+        eMT->act_block += block_size;
+        if ( eMT->break_flag ) {
+            break;
+        }
+    }
+
+    delete [] p_blockJ_pattern;
+    delete [] Atmp;
+}
+
 void SparseGridMtx :: MultiplyByVector(const LargeVectorAttach &x, LargeVectorAttach &y)
 {
     printf("SparseGridMtx::MultiplyByVector not implemented, file %s, line %d\n", __FILE__, __LINE__);
@@ -120,6 +120,20 @@ public:
     virtual void times(double x);
     virtual void Factorize() = 0;
 
+protected:
+    // Factorizes all block columns by FactorizeColumn. With OpenMP, the columns are grouped into
+    // levels of the elimination tree (a column depends only on the columns in its pattern) and the
+    // columns of each level, i.e. independent subtrees, are factorized concurrently.
+    void FactorizeColumns();
+
+    // Factorizes block column bj. The pattern array (n_blocks+1 long, zero on entry and exit),
+    // the temporary block and the arithmetics are private to the calling thread.
+    virtual void FactorizeColumn(long bj, long *p_blockJ_pattern, double *Atmp, DenseMatrixArithmetics *arith) = 0;
+
+    // Computes the elimination levels of block columns. Columns of level l are stored in
+    // level_columns[level_ptr[l]] ... level_columns[level_ptr[l+1]-1]. Returns the number of levels.
+    long ComputeColumnLevels(long * &level_ptr, long * &level_columns);
+
 public:
 
     virtual void SchurComplementFactorization(int fixed_blocks) = 0;
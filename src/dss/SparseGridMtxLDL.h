@@ -114,6 +114,11 @@ public:
     virtual void times(double x);
     
     virtual void Factorize();
+
+protected:
+    virtual void FactorizeColumn(long bj, long *p_blockJ_pattern, double *Atmp, DenseMatrixArithmetics *arith);
+
+public:
     virtual void Factorize_Incomplete();
 
     LargeVector *tmp_vector_BS_nodes;
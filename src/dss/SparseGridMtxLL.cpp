@@ -295,91 +295,71 @@ void SparseGridMtxLL :: MultiplyByVector(const LargeVectorAttach &x, LargeVector
 
 void SparseGridMtxLL :: Factorize()
 {
-    //double* Atmp = new double[block_storage];
-    long bi, bj, min_bi_J = 0;
-
-    // This is a pattern of blocks in J-th column
-    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
-    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
-
-    //    long newdotcnount = ( long ) ceil( ( double ) n_blocks / 24.0 );
-    //long newdotcnount = n / 24;
     BlockArith->zero_pivots = 0;
 
-    double *cd = this->Columns_data;
-    //double* atmp = Atmp;
-    {
-        double *dd = cd;
-        //double* idd = cd;
-        long Djj = 0;
-        eMT->act_block = 0;
-        for ( bj = 0; bj < n_blocks; bj++ ) {
-            SparseGridColumn &columnJ = * Columns [ bj ];
-            long noJentries = columnJ.Entries;
-            if ( noJentries > 0 ) {
-                long *columnJentries = columnJ.IndexesUfa->Items;
-                double *pAkj = cd + columnJ.column_start_idx;
-                double *pAij = pAkj;
+    FactorizeColumns();
+    ComputeBlocks();
+}
 
-                //columnJ.DrawColumnPattern(p_blockJ_pattern,ref min_bi_J,bj);
-                min_bi_J = bj;
-                for ( long i = noJentries - 1; i >= 0; i-- ) {
-                    p_blockJ_pattern [ min_bi_J = columnJentries [ i ] ] = ~( i * block_storage );
-                }
+void SparseGridMtxLL :: FactorizeColumn(long bj, long *p_blockJ_pattern, double *Atmp, DenseMatrixArithmetics *arith)
+{
+    long bi, min_bi_J = 0;
 
-                // eliminate above diagonal
-                for ( long idx_J = 0; idx_J < noJentries; idx_J++ ) {
-                    bi = columnJentries [ idx_J ];
+    double *cd = this->Columns_data;
+    double *dd = cd;
+    long Djj = bj * block_storage;
+
+    SparseGridColumn &columnJ = * Columns [ bj ];
+    long noJentries = columnJ.Entries;
+    if ( noJentries > 0 ) {
+        long *columnJentries = columnJ.IndexesUfa->Items;
+        double *pAkj = cd + columnJ.column_start_idx;
+        double *pAij = pAkj;
+
+        //columnJ.DrawColumnPattern(p_blockJ_pattern,ref min_bi_J,bj);
+        min_bi_J = bj;
+        for ( long i = noJentries - 1; i >= 0; i-- ) {
+            p_blockJ_pattern [ min_bi_J = columnJentries [ i ] ] = ~( i * block_storage );
+        }
 
-                    SparseGridColumn &columnI = * Columns [ bi ];
-                    long noIentries = columnI.Entries;
+        // eliminate above diagonal
+        for ( long idx_J = 0; idx_J < noJentries; idx_J++ ) {
+            bi = columnJentries [ idx_J ];
 
-                    if ( noIentries > 0 ) {
-                        double *pAki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
-                        long *columnIentries = columnI.IndexesUfa->Items;
-                        for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage ) {
-                            long idx_K = p_blockJ_pattern [ * columnIentry-- ];
-                            if ( idx_K == 0 ) {
-                                continue;
-                            }
+            SparseGridColumn &columnI = * Columns [ bi ];
+            long noIentries = columnI.Entries;
 
-                            BlockArith->SubATBproduct(pAij, pAki, pAkj + ~idx_K);
-                        }
+            if ( noIentries > 0 ) {
+                double *pAki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
+                long *columnIentries = columnI.IndexesUfa->Items;
+                for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage ) {
+                    long idx_K = p_blockJ_pattern [ * columnIentry-- ];
+                    if ( idx_K == 0 ) {
+                        continue;
                     }
 
-                    BlockArith->L_BlockSolve(dd + bi * block_storage, pAij);
-                    pAij += block_storage;
-                }
-
-                // compute the diagonal and divide by it
-                //DenseMatrix Djj = DiagonalBlocks[bj];// Diagonal
-                for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
-                    bi = columnJentries [ idx ];
-                    //Clear pattern
-                    p_blockJ_pattern [ bi ] = 0;
-
-                    int ij = columnJ.column_start_idx + idx * block_storage;
-                    BlockArith->SubATBproduct(dd + Djj, cd + ij, cd + ij);
+                    arith->SubATBproduct(pAij, pAki, pAkj + ~idx_K);
                 }
             }
 
-            // Factorize diagonal block
-            BlockArith->LL_Decomposition(dd + Djj);
+            arith->L_BlockSolve(dd + bi * block_storage, pAij);
+            pAij += block_storage;
+        }
 
-            /*if ( ( bj % newdotcnount ) == 0 ) {
-                Write(".");
-		}*/
+        // compute the diagonal and divide by it
+        //DenseMatrix Djj = DiagonalBlocks[bj];// Diagonal
+        for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
+            bi = columnJentries [ idx ];
+            //Clear pattern
+            p_blockJ_pattern [ bi ] = 0;
 
-            Djj += block_storage;
-            eMT->act_block += block_size;
-            if ( eMT->break_flag ) {
-                break;
-            }
+            int ij = columnJ.column_start_idx + idx * block_storage;
+            arith->SubATBproduct(dd + Djj, cd + ij, cd + ij);
         }
     }
-    delete [] p_blockJ_pattern;
-    //delete [] Atmp;
-    ComputeBlocks();
+
+    // Factorize diagonal block
+    arith->LL_Decomposition(dd + Djj);
 }
 
 void SparseGridMtxLL :: Factorize_Incomplete()
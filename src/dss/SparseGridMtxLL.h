@@ -84,6 +84,11 @@ public:
     virtual void LoadMatrixNumbers(SparseMatrixF &sm);
     virtual void SolveLV(const LargeVector &b, LargeVector &x);
     virtual void Factorize();
+
+protected:
+    virtual void FactorizeColumn(long bj, long *p_blockJ_pattern, double *Atmp, DenseMatrixArithmetics *arith);
+
+public:
     virtual void Factorize_Incomplete();
     virtual void MultiplyByVector(const LargeVectorAttach &x, LargeVectorAttach &y);
 
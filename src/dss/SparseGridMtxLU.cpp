@@ -298,97 +298,80 @@ void SparseGridMtxLU :: MultiplyByVector(const LargeVectorAttach &x, LargeVector
 
 void SparseGridMtxLU :: Factorize()
 {
-    long bi, bj, min_bi_J = 0;
+    BlockArith->zero_pivots = 0;
 
-    // This is a pattern of blocks in J-th column
-    long *p_blockJ_pattern = new long [ n_blocks + 1 ];
-    memset( p_blockJ_pattern, 0, ( n_blocks + 1 ) * sizeof( long ) );
+    FactorizeColumns();
+    ComputeBlocks();
+}
 
-    //    long newdotcnount = ( long ) ceil( ( double ) n_blocks / 24.0 );
-    //long newdotcnount = n / 24;
-    BlockArith->zero_pivots = 0;
+void SparseGridMtxLU :: FactorizeColumn(long bj, long *p_blockJ_pattern, double *Atmp, DenseMatrixArithmetics *arith)
+{
+    long bi, min_bi_J = 0;
 
     double *cd = this->Columns_data;
     double *rd = this->Rows_data;
     double *dd = this->Diagonal_data;
-    {
-        //double* idd = dd;
-        long Djj = 0;
-        eMT->act_block = 0;
-        for ( bj = 0; bj < n_blocks; bj++ ) {
-            SparseGridColumn &columnJ = * Columns [ bj ];
-            long noJentries = columnJ.Entries;
-            if ( noJentries > 0 ) {
-                long *columnJentries = columnJ.IndexesUfa->Items;
+    long Djj = bj * block_storage;
 
-                double *pBkj = cd + columnJ.column_start_idx;
-                double *pBij = pBkj;
-                double *pAkj = rd + columnJ.column_start_idx;
-                double *pAij = pAkj;
+    SparseGridColumn &columnJ = * Columns [ bj ];
+    long noJentries = columnJ.Entries;
+    if ( noJentries > 0 ) {
+        long *columnJentries = columnJ.IndexesUfa->Items;
 
+        double *pBkj = cd + columnJ.column_start_idx;
+        double *pBij = pBkj;
+        double *pAkj = rd + columnJ.column_start_idx;
+        double *pAij = pAkj;
 
-                //columnJ.DrawColumnPattern(p_blockJ_pattern,ref min_bi_J,bj);
-                min_bi_J = bj;
-                for ( long i = noJentries - 1; i >= 0; i-- ) {
-                    p_blockJ_pattern [ min_bi_J = columnJentries [ i ] ] = ~( i * block_storage );
-                }
 
-                // eliminate above diagonal
-                for ( long idx_J = 0; idx_J < noJentries; idx_J++ ) {
-                    bi = columnJentries [ idx_J ];
+        //columnJ.DrawColumnPattern(p_blockJ_pattern,ref min_bi_J,bj);
+        min_bi_J = bj;
+        for ( long i = noJentries - 1; i >= 0; i-- ) {
+            p_blockJ_pattern [ min_bi_J = columnJentries [ i ] ] = ~( i * block_storage );
+        }
 
-                    SparseGridColumn &columnI = * Columns [ bi ];
-                    long noIentries = columnI.Entries;
+        // eliminate above diagonal
+        for ( long idx_J = 0; idx_J < noJentries; idx_J++ ) {
+            bi = columnJentries [ idx_J ];
 
-                    if ( noIentries > 0 ) {
-                        double *pBki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
-                        double *pAki = rd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
+            SparseGridColumn &columnI = * Columns [ bi ];
+            long noIentries = columnI.Entries;
 
-                        long *columnIentries = columnI.IndexesUfa->Items;
-                        for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage, pBki -= block_storage ) {
-                            long idx_K = p_blockJ_pattern [ * columnIentry-- ];
-                            if ( idx_K == 0 ) {
-                                continue;
-                            }
+            if ( noIentries > 0 ) {
+                double *pBki = cd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
+                double *pAki = rd + columnI.column_start_idx + ( noIentries - 1 ) * block_storage;
 
-                            BlockArith->SubATBproduct(pBij, pAki, pBkj + ~idx_K);
-                            BlockArith->SubATBproduct(pAij, pBki, pAkj + ~idx_K);
-                        }
+                long *columnIentries = columnI.IndexesUfa->Items;
+                for ( long *columnIentry = columnIentries + noIentries - 1; columnIentry >= columnIentries; pAki -= block_storage, pBki -= block_storage ) {
+                    long idx_K = p_blockJ_pattern [ * columnIentry-- ];
+                    if ( idx_K == 0 ) {
+                        continue;
                     }
 
-                    BlockArith->ULT_BlockSolve(dd + bi * block_storage, pAij);
-                    pAij += block_storage;
-                    pBij += block_storage;
-                }
-
-                // compute the diagonal and divide by it
-                //DenseMatrix Djj = DiagonalBlocks[bj];// Diagonal
-                for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
-                    bi = columnJentries [ idx ];
-                    //Clear pattern
-                    p_blockJ_pattern [ bi ] = 0;
-
-                    int ij = columnJ.column_start_idx + idx * block_storage;
-                    BlockArith->SubATBproduct(dd + Djj, rd + ij, cd + ij);
+                    arith->SubATBproduct(pBij, pAki, pBkj + ~idx_K);
+                    arith->SubATBproduct(pAij, pBki, pAkj + ~idx_K);
                 }
             }
 
-            // Factorize diagonal block
-            BlockArith->LU_Decomposition(dd + Djj);
+            arith->ULT_BlockSolve(dd + bi * block_storage, pAij);
+            pAij += block_storage;
+            pBij += block_storage;
+        }
 
-            /*if ( ( bj % newdotcnount ) == 0 ) {
-                Write(".");
-		}*/
+        // compute the diagonal and divide by it
+        //DenseMatrix Djj = DiagonalBlocks[bj];// Diagonal
+        for ( long idx = noJentries - 1; idx >= 0; idx-- ) {
+            bi = columnJentries [ idx ];
+            //Clear pattern
+            p_blockJ_pattern [ bi ] = 0;
 
-            Djj += block_storage;
-            eMT->act_block += block_size;
-            if ( eMT->break_flag ) {
-                break;
-            }
+            int ij = columnJ.column_start_idx + idx * block_storage;
+            arith->SubATBproduct(dd + Djj, rd + ij, cd + ij);
         }
     }
-    delete [] p_blockJ_pattern;
-    ComputeBlocks();
+
+    // Factorize diagonal block
+    arith->LU_Decomposition(dd + Djj);
 }
 
 // This functions computes LDL' decomposition of first (nblocks-fixed_bn) columns
@@ -43,11 +43,15 @@
 #define delaunaytrinagulator_h
 
 #include <list>
+#include <vector>
+#include <array>
+#include <unordered_map>
 #include "contextioresulttype.h"
 #include "timer.h"
 #include "octreelocalizert.h"
 #include "octreelocalizertutil.h"
 #include "intarray.h"
+#include "floatarray.h"
 #include "edge2d.h"
 
 namespace oofem {
@@ -61,6 +65,10 @@ class InsertionData;
  * Mesh generator for the PFEM problem, using Bowyer-Watson algorithm of the Delaunay triangulation
  * of a set of nodes (PFEMParticle) creating TR1_2D_PFEM elements.
  *
+ * The triangulation including the bounding box nodes is kept after the mesh has been generated,
+ * so that the mesh of the moved particles can be obtained by updateMesh, which restores
+ * the Delaunay property of the previous triangulation by edge flipping (Lawson's algorithm).
+ *
  * @author David Krybus
  */
 class DelaunayTriangulator
@@ -92,6 +100,17 @@ protected:
 
     /// contains all edges of the triangulation
     std :: list< AlphaEdge2D * >edgeList;
+    /// Edges of edgeList hashed by their node numbers
+    std :: unordered_map< long long, AlphaEdge2D * >edgeMap;
+
+    /// Complete Delaunay triangulation (including bounding box nodes) with counter-clockwise oriented triangles
+    std :: vector< std :: array< int, 3 > >triangulation;
+    /// Neighbouring triangles opposite to triangle vertices, -1 on the boundary
+    std :: vector< std :: array< int, 3 > >neighbours;
+    /// Coordinates of the bounding box nodes of the stored triangulation
+    std :: array< FloatArray, 4 >bbxCoordinates;
+    /// Activity of particles at the time the triangulation was stored
+    std :: vector< bool >particleActivity;
 
     /// Octree with Delaunay triangles allowing fast search
     OctreeSpatialLocalizerT< DelaunayTriangle * >triangleOctree;
@@ -104,6 +123,12 @@ public:
 
     /// Main call
     void generateMesh();
+    /**
+     * Updates the mesh of moved particles. The stored triangulation is repaired by edge flipping,
+     * the mesh is regenerated from scratch if there is no triangulation yet, if the set of active
+     * particles has changed, or if the particle motion has inverted some triangle.
+     */
+    void updateMesh();
 
 private:
     /// Edge is added to the polygon only if it's not contained. Otherwise both are removed (edge shared by two non-Delaunay triangles).
@@ -118,9 +143,9 @@ private:
     void computeAlphaComplex();
 
     /**
-     * Fills the edgeList with unique alphaEdges. If an edge is already contained a pointer to it is returned and inserted edge is removed.
+     * Fills the edgeList with unique alphaEdges. If an edge is already contained a pointer to it is returned, otherwise the edge is inserted.
      */
-    AlphaEdge2D *giveBackEdgeIfAlreadyContainedInList(AlphaEdge2D &alphaEdge);
+    AlphaEdge2D *giveBackEdgeIfAlreadyContainedInList(AlphaEdge2D *alphaEdge);
 
     /// Iterates through the edgeList container and compares alpha-value with alphaEdge bounds. Alpha shape is stored in the alphaShapeEdgeList
     void giveAlphaShape();
@@ -136,6 +161,24 @@ private:
     void giveTimeReport();
     /// Iterates through generalTringleList und removes non-valid ones or those containing bounding box nodes
     void cleanUpTriangleList();
+    /// Removes all triangles and edges of the previous mesh
+    void clear();
+    /// Computes the alpha shape and writes the triangles of generalTriangleList into the domain
+    void finishMesh();
+
+    /// Stores the valid triangles of generalTriangleList (bounding box nodes have to be still present in the domain)
+    void storeTriangulation();
+    /// Sets up the neighbours of the stored triangulation
+    void buildNeighbours();
+    /**
+     * Flips the edges of the stored triangulation until all of them are locally Delaunay.
+     * @return False if some triangle has been inverted by the particle motion.
+     */
+    bool restoreDelaunayProperty();
+    /// Flips the edge opposite to the local vertex k of triangle t
+    void flipEdge(int t, int k);
+    /// Gives the coordinates of node i of the stored triangulation
+    const FloatArray &giveTriangulationCoordinates(int i);
 
     /// Calculates the bounding box base on the domain's nodes
     void computeBBXBasedOnNodeData(BoundingBox &BBX);
@@ -78,11 +78,11 @@ public:
     void updateYourself(TimeStep *tStep) override;
 
     void givePrescribedUnknownVector(FloatArray &answer, const IntArray &dofMask,
-                                     ValueModeType mode, TimeStep *stepN) override;
+                                     ValueModeType mode, TimeStep *stepN);
 
     void giveCoupledVelocities(FloatArray &answer, TimeStep *stepN);
 
-    void printOutputAt(FILE *stream, TimeStep *stepN) const override;
+    void printOutputAt(FILE *stream, TimeStep *stepN) override;
 
     const char *giveClassName() const override { return "InteractionPFEMParticle"; }
     const char *giveInputRecordName() const override { return _IFT_InteractionPFEMParticle_Name; }
@@ -60,10 +60,13 @@
 #define _IFT_PFEM_rtolv "rtolv"
 #define _IFT_PFEM_rtolp "rtolp"
 #define _IFT_PFEM_maxiter "maxiter"
+#define _IFT_PFEM_incrementalMeshing "incrementalmeshing"
 
 //@}
 
 namespace oofem {
+class DelaunayTriangulator;
+
 /**
  * Implementation of callback class for assembling right-hand side of pressure equations
  */
@@ -125,7 +128,7 @@ class PFEM : public EngngModel
 {
 protected:
     /// Numerical method used to solve the problem
-    SparseLinearSystemNM *nMethod;
+    std :: unique_ptr< SparseLinearSystemNM >nMethod;
     /// Used solver type for linear system of equations
     LinSystSolverType solverType;
     /// Used type of sparse matrix
@@ -167,6 +170,11 @@ protected:
     /// Explicit or implicit time discretization
     int discretizationScheme;
 
+    /// Flag for updating the previous triangulation instead of generating a new one in every step
+    bool incrementalMeshing;
+    /// Mesh generator kept between the steps for incremental meshing
+    std :: unique_ptr< DelaunayTriangulator >mesher;
+
     /// Number of cross section to associate with created elements
     int associatedCrossSection;
     /// Number of material to associate with created elements
@@ -184,27 +192,8 @@ protected:
     VelocityNumberingScheme prescribedVns;
 
 public:
-    PFEM(int i, EngngModel *_master = nullptr) :
-        EngngModel(i, _master)
-        , avLhs()
-        , pLhs()
-        , vLhs()
-        , PressureField(this, 1, FT_Pressure, 1)
-        , VelocityField(this, 1, FT_Velocity, 1)
-        , pns()
-        , vns(false)
-        , prescribedVns(true)
-    {
-        ndomains = 1;
-        nMethod = NULL;
-        domainVolume = 0.0;
-        printVolumeReport = false;
-        discretizationScheme = 1; // implicit iterative scheme is default
-        associatedCrossSection = 0;
-        associatedMaterial = 0;
-        associatedPressureBC = 0;
-    }
-    ~PFEM() { }
+    PFEM(int i, EngngModel *_master = nullptr);
+    ~PFEM();
 
     void solveYourselfAt(TimeStep *) override;
     /**
@@ -221,7 +210,7 @@ public:
     void restoreContext(DataStream &stream, ContextMode mode) override;
 
     TimeStep *giveNextStep() override;
-    TimeStep *giveSolutionStepWhenIcApply() override;
+    TimeStep *giveSolutionStepWhenIcApply(bool force = false) override;
     NumericalMethod *giveNumericalMethod(MetaStep *) override;
 
     /** Removes all elements and call DelaunayTriangulator to build up new mesh with new recognized boundary.
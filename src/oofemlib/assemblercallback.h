@@ -39,11 +39,19 @@
 #include "matresponsemode.h"
 #include "chartype.h"
 
+#include <vector>
+
+///@name Number of consecutive elements handed to MatrixAssembler::matrixFromElementBatch at once
+//@{
+#define MatrixAssembler_ELEMENT_BATCH 8
+//@}
+
 namespace oofem {
 class IntArray;
 class FloatArray;
 class FloatMatrix;
 class Element;
+class Domain;
 class DofManager;
 class TimeStep;
 class NodalLoad;
@@ -54,6 +62,7 @@ class EdgeLoad;
 class UnknownNumberingScheme;
 class SparseMtrx;
 class ActiveBoundaryCondition;
+class ContactManager;
 
 /**
  * Callback class for assembling specific types of vectors.
@@ -69,6 +78,7 @@ public:
     virtual void vectorFromEdgeLoad(FloatArray &vec, Element &element, EdgeLoad *load, int edge, TimeStep *tStep, ValueModeType mode) const;
     virtual void vectorFromNodeLoad(FloatArray &vec, DofManager &dman, NodalLoad *load, TimeStep *tStep, ValueModeType mode) const;
     virtual void assembleFromActiveBC(FloatArray &answer, ActiveBoundaryCondition &bc, TimeStep* tStep, ValueModeType mode, const UnknownNumberingScheme &s, FloatArray *eNorms, void* lock=nullptr) const;
+    virtual void assembleFromContacts(FloatArray &answer, ContactManager &cMan, TimeStep* tStep, ValueModeType mode, const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms) const;
 
     /// Default implementation takes all the DOF IDs
     virtual void locationFromElement(IntArray &loc, Element &element, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
@@ -84,10 +94,21 @@ class MatrixAssembler
 {
 public:
     virtual void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const;
+    /**
+     * Computes the matrices of a batch of elements at once.
+     * Default implementation returns false, the elements are then evaluated one by one by matrixFromElement.
+     * @param mats Element matrices, one for each element in elems.
+     * @param domain Domain of elements.
+     * @param elems Element numbers.
+     * @param tStep Time step.
+     * @return True if all matrices have been computed.
+     */
+    virtual bool matrixFromElementBatch(std :: vector< FloatMatrix > &mats, Domain &domain, const IntArray &elems, TimeStep *tStep) const { return false; }
     virtual void matrixFromLoad(FloatMatrix &mat, Element &element, BodyLoad *load, TimeStep *tStep) const;
     virtual void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const;
     virtual void matrixFromEdgeLoad(FloatMatrix &mat, Element &element, EdgeLoad *load, int edge, TimeStep *tStep) const;
     virtual void assembleFromActiveBC(SparseMtrx &k, ActiveBoundaryCondition &bc, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c, void* lock=nullptr) const;
+    virtual void assembleFromContacts(SparseMtrx &k, ContactManager &cMan, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c) const;
 
     virtual void locationFromElement(IntArray &loc, Element &element, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
     virtual void locationFromElementNodes(IntArray &loc, Element &element, const IntArray &bNodes, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
@@ -106,6 +127,7 @@ public:
     void vectorFromSurfaceLoad(FloatArray &vec, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep, ValueModeType mode) const override;
     void vectorFromEdgeLoad(FloatArray &vec, Element &element, EdgeLoad *load, int edge, TimeStep *tStep, ValueModeType mode) const override;
     void assembleFromActiveBC(FloatArray &answer, ActiveBoundaryCondition &bc, TimeStep* tStep, ValueModeType mode, const UnknownNumberingScheme &s, FloatArray *eNorms, void* lock=nullptr) const override;
+    void assembleFromContacts(FloatArray &answer, ContactManager &cMan, TimeStep* tStep, ValueModeType mode, const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms) const override;
 };
 
 /**
@@ -192,10 +214,12 @@ public:
     TangentAssembler(MatResponseMode m = TangentStiffness): MatrixAssembler(), rmode(m) {}
 
     void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const override;
+    bool matrixFromElementBatch(std :: vector< FloatMatrix > &mats, Domain &domain, const IntArray &elems, TimeStep *tStep) const override;
     void matrixFromLoad(FloatMatrix &mat, Element &element, BodyLoad *load, TimeStep *tStep) const override;
     void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const override;
     void matrixFromEdgeLoad(FloatMatrix &mat, Element &element, EdgeLoad *load, int edge, TimeStep *tStep) const override;
     void assembleFromActiveBC(SparseMtrx &k, ActiveBoundaryCondition &bc, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c, void*lock=nullptr) const override;
+    void assembleFromContacts(SparseMtrx &k, ContactManager &cMan, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c) const override;
 };
 
 
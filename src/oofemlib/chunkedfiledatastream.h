@@ -0,0 +1,254 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef chunkedfiledatastream_h
+#define chunkedfiledatastream_h
+
+#include "datastream.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+///@name Parameters of the chunked context file format
+//@{
+/// Format version written to the file header.
+#define ChunkedFileDataStream_VERSION 1
+/// Uncompressed size (in bytes) after which the current chunk is flushed to the file.
+#define ChunkedFileDataStream_CHUNK_SIZE ( 4 * 1024 * 1024 )
+/// Number of components (elements, dof managers) stored in one independently loadable section.
+#define ChunkedFileDataStream_SECTION_OBJECTS 4096
+//@}
+
+namespace oofem {
+/**
+ * DataStream reading from/writing to a memory buffer.
+ * In write mode, the data are appended to an internal buffer. In read mode, the stream
+ * either refers to an external memory block (which must outlive the stream) or owns the buffer.
+ * Used to serialize independent sections of a ChunkedFileDataStream in parallel.
+ */
+class OOFEM_EXPORT MemoryDataStream : public DataStream
+{
+protected:
+    /// Owned data (written data or decompressed section).
+    std :: string buffer;
+    /// Data being read.
+    const char *data;
+    /// Size of data being read.
+    size_t size;
+    /// Current read position.
+    size_t pos;
+
+public:
+    /// Creates an empty stream for writing.
+    MemoryDataStream() : buffer(), data(nullptr), size(0), pos(0) { }
+    /// Creates a stream reading given memory block (not owned).
+    MemoryDataStream(const char *data, size_t size) : buffer(), data(data), size(size), pos(0) { }
+    /// Creates a stream reading given buffer (owned).
+    MemoryDataStream(std :: string buff) : buffer(std :: move(buff)), data(buffer.data()), size(buffer.size()), pos(0) { }
+    MemoryDataStream(const MemoryDataStream &) = delete;
+    MemoryDataStream &operator = (const MemoryDataStream &) = delete;
+
+    /// Returns the written data.
+    const std :: string &giveBuffer() const { return buffer; }
+
+    /// Reads n bytes into dest, returns nonzero if successful.
+    int readBytes(void *dest, size_t n);
+    /// Appends n bytes from src, returns nonzero if successful.
+    int writeBytes(const void *src, size_t n);
+
+    using DataStream :: read;
+    using DataStream :: write;
+
+    int read(int *data, int count) override { return readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, int count) override { return readBytes(data, sizeof( unsigned long ) * count); }
+    int read(long *data, int count) override { return readBytes(data, sizeof( long ) * count); }
+    int read(double *data, int count) override { return readBytes(data, sizeof( double ) * count); }
+    int read(char *data, int count) override { return readBytes(data, sizeof( char ) * count); }
+    int read(bool &data) override { return readBytes(& data, sizeof( bool ) ); }
+
+    int write(const int *data, int count) override { return writeBytes(data, sizeof( int ) * count); }
+    int write(const unsigned long *data, int count) override { return writeBytes(data, sizeof( unsigned long ) * count); }
+    int write(const long *data, int count) override { return writeBytes(data, sizeof( long ) * count); }
+    int write(const double *data, int count) override { return writeBytes(data, sizeof( double ) * count); }
+    int write(const char *data, int count) override { return writeBytes(data, sizeof( char ) * count); }
+    int write(bool data) override { return writeBytes(& data, sizeof( bool ) ); }
+
+    int givePackSizeOfInt(int count) override { return sizeof( int ) * count; }
+    int givePackSizeOfDouble(int count) override { return sizeof( double ) * count; }
+    int givePackSizeOfChar(int count) override { return sizeof( char ) * count; }
+    int givePackSizeOfBool(int count) override { return sizeof( bool ) * count; }
+    int givePackSizeOfLong(int count) override { return sizeof( long ) * count; }
+};
+
+
+/**
+ * DataStream implementing a chunked, indexed binary container for context (restart) files.
+ *
+ * The data are written in chunks of ChunkedFileDataStream_CHUNK_SIZE bytes, optionally compressed
+ * with zlib (requires __ZLIB_MODULE). The index of all chunks is appended at the end of the file,
+ * so that a file can be written in a single pass. Each chunk belongs to a section; sections
+ * allow independent parts of the data (blocks of elements or dof managers) to be written from
+ * separately serialized MemoryDataStreams and to be read back concurrently.
+ *
+ * For reading, the whole file is memory mapped; uncompressed data are read directly from the
+ * mapping, so that restoring is bound by the disk bandwidth only.
+ * Reading and writing through the DataStream interface is sequential, section boundaries are
+ * transparent to it.
+ *
+ * File layout (all integers in native byte order):
+ * - header: "OOFEMCTX", uint32 version, uint32 flags
+ * - chunks
+ * - index: (uint64 offset, uint64 stored size, uint64 raw size, uint32 section, uint32 flags) for every chunk
+ * - trailer: uint64 number of chunks, uint64 index offset, "OOFEMIDX"
+ */
+class OOFEM_EXPORT ChunkedFileDataStream : public DataStream
+{
+protected:
+    /// Record of the chunk index.
+    struct ChunkRecord {
+        uint64_t offset;
+        uint64_t storedSize;
+        uint64_t rawSize;
+        uint32_t section;
+        uint32_t flags;
+    };
+
+    /// Filename.
+    std :: string filename;
+    /// Write mode flag.
+    bool writeMode;
+    /// Compress chunks when writing.
+    bool compressFlag;
+    /// Index of the chunks.
+    std :: vector< ChunkRecord >index;
+
+    /// File being written.
+    FILE *stream;
+    /// Current chunk (write mode), or the decompressed current chunk (read mode).
+    std :: string chunk;
+    /// Current section (write mode).
+    int currentSection;
+    /// File offset of the next chunk (write mode).
+    uint64_t fileOffset;
+
+    /// Mapped file (read mode).
+    const char *map;
+    /// Size of the mapped file.
+    size_t mapSize;
+    /// File contents if memory mapping is not available.
+    std :: vector< char >fileData;
+    /// Index of the chunk being read.
+    long currentChunk;
+    /// Data of the chunk being read.
+    const char *chunkData;
+    /// Size and read position in the chunk being read.
+    size_t chunkSize, chunkPos;
+
+public:
+    /**
+     * Constructor. Opens given file for reading or writing.
+     * @param filename File name.
+     * @param write True for writing.
+     * @param compress Compress written chunks (ignored without zlib support and when reading).
+     * @exception FileDataStream::CantOpen if the file can't be opened or is not a valid container.
+     */
+    ChunkedFileDataStream(std :: string filename, bool write, bool compress = false);
+    /// Destructor. Flushes the pending data and writes the index (write mode) or unmaps the file.
+    virtual ~ChunkedFileDataStream();
+    ChunkedFileDataStream(const ChunkedFileDataStream &) = delete;
+    ChunkedFileDataStream &operator = (const ChunkedFileDataStream &) = delete;
+
+    /// Returns true if given file exists and starts with the header of the chunked format.
+    static bool isChunkedFile(const std :: string &filename);
+
+    /**
+     * Starts a new section. The data written afterwards belong to the new section.
+     */
+    void startSection();
+    /**
+     * Starts a new section and writes the contents of given stream into it.
+     */
+    void writeSection(const MemoryDataStream &section);
+    /// Returns the section of the data written/read last.
+    int giveCurrentSection() const;
+    /**
+     * Returns an independent stream over all data of given section. The returned stream refers
+     * to the memory mapping for uncompressed data; it must not outlive the receiver.
+     * This method does not change the state of the receiver and can be called concurrently.
+     */
+    std :: unique_ptr< MemoryDataStream >giveSectionStream(int section) const;
+    /// Positions the sequential reading at the beginning of given section.
+    void seekSection(int section);
+
+    using DataStream :: read;
+    using DataStream :: write;
+
+    int read(int *data, int count) override { return readBytes(data, sizeof( int ) * count); }
+    int read(unsigned long *data, int count) override { return readBytes(data, sizeof( unsigned long ) * count); }
+    int read(long *data, int count) override { return readBytes(data, sizeof( long ) * count); }
+    int read(double *data, int count) override { return readBytes(data, sizeof( double ) * count); }
+    int read(char *data, int count) override { return readBytes(data, sizeof( char ) * count); }
+    int read(bool &data) override { return readBytes(& data, sizeof( bool ) ); }
+
+    int write(const int *data, int count) override { return writeBytes(data, sizeof( int ) * count); }
+    int write(const unsigned long *data, int count) override { return writeBytes(data, sizeof( unsigned long ) * count); }
+    int write(const long *data, int count) override { return writeBytes(data, sizeof( long ) * count); }
+    int write(const double *data, int count) override { return writeBytes(data, sizeof( double ) * count); }
+    int write(const char *data, int count) override { return writeBytes(data, sizeof( char ) * count); }
+    int write(bool data) override { return writeBytes(& data, sizeof( bool ) ); }
+
+    int givePackSizeOfInt(int count) override { return sizeof( int ) * count; }
+    int givePackSizeOfDouble(int count) override { return sizeof( double ) * count; }
+    int givePackSizeOfChar(int count) override { return sizeof( char ) * count; }
+    int givePackSizeOfBool(int count) override { return sizeof( bool ) * count; }
+    int givePackSizeOfLong(int count) override { return sizeof( long ) * count; }
+
+protected:
+    /// Reads n bytes into dest, returns nonzero if successful.
+    int readBytes(void *dest, size_t n);
+    /// Writes n bytes from src, returns nonzero if successful.
+    int writeBytes(const void *src, size_t n);
+    /// Writes the current chunk to the file.
+    void flushChunk();
+    /// Makes given chunk the current one for reading.
+    bool loadChunk(long ichunk);
+    /// Gives the uncompressed data of given chunk, using buffer for decompression if necessary.
+    const char *giveChunkData(const ChunkRecord &rec, std :: string &buffer) const;
+    /// Maps the file into memory and reads the index.
+    void openForReading();
+};
+} // end namespace oofem
+#endif // chunkedfiledatastream_h
@@ -0,0 +1,120 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef compactdofstore_h
+#define compactdofstore_h
+
+#include "oofemcfg.h"
+#include "valuemodetype.h"
+#include "statecountertype.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+class TimeStep;
+class FloatArray;
+class IntArray;
+
+/**
+ * Compact (structure of arrays) copy of the dof data of all dof managers of a domain.
+ * The DOF IDs, equation numbers and boundary condition ids of the dofs are kept in contiguous arrays,
+ * with the dofs of each dof manager stored in consecutive entries.
+ * It allows to gather the unknowns of dof managers directly from the solution vector of engineering
+ * model (see EngngModel::giveDirectUnknownVector), without going through the individual Dof objects.
+ *
+ * The store is built by the engineering model after the equation numbering. Any later change of the dofs
+ * (equation numbers, boundary conditions, adding or removing dofs) increments the dof state counter of
+ * the domain, after which the store is not used until it is built again.
+ */
+class OOFEM_EXPORT CompactDofStore
+{
+protected:
+    /// Domain of receiver.
+    Domain *domain;
+    /// Position of the first dof of each dof manager in the dof arrays (size number of dof managers + 1).
+    std :: vector< int >offsets;
+    /// DOF IDs.
+    std :: vector< int >dofIDs;
+    /// Equation numbers (positive), prescribed equation numbers (negative) or zero for dofs which are not master dofs.
+    std :: vector< int >equations;
+    /// Boundary condition ids.
+    std :: vector< int >bcs;
+    /// Flags of dof managers, whose unknowns are expressed in global coordinate system and can be gathered directly.
+    std :: vector< bool >directFlags;
+    /// Dof state counter of domain the receiver has been built for.
+    StateCounterType stateCounter;
+    /// Flag indicating that the store has been built.
+    bool built;
+
+public:
+    CompactDofStore(Domain *d) : domain(d), stateCounter(0), built(false) { }
+
+    /// Builds the receiver from the current dofs of the domain dof managers.
+    void build();
+    /// Returns true if receiver has been built and the dofs of the domain have not changed since.
+    bool isValid() const;
+
+    /// Returns number of dofs of given dof manager.
+    int giveNumberOfDofs(int dman) const { return offsets [ dman ] - offsets [ dman - 1 ]; }
+    /// Returns DOF ID of i-th dof of given dof manager.
+    int giveDofID(int dman, int i) const { return dofIDs [ offsets [ dman - 1 ] + i - 1 ]; }
+    /// Returns equation number (negative for prescribed equations) of i-th dof of given dof manager.
+    int giveEquationNumber(int dman, int i) const { return equations [ offsets [ dman - 1 ] + i - 1 ]; }
+    /// Returns boundary condition id of i-th dof of given dof manager.
+    int giveBcId(int dman, int i) const { return bcs [ offsets [ dman - 1 ] + i - 1 ]; }
+
+    /**
+     * Returns the vector of unknowns of engineering model indexed by equation numbers, from which
+     * the unknowns can be gathered by giveUnknownVector.
+     * @param mode Mode of unknowns.
+     * @param tStep Time step.
+     * @return Vector of unknowns, NULL if the store is not valid or the unknowns are not directly available.
+     */
+    const FloatArray *giveDirectUnknownVector(ValueModeType mode, TimeStep *tStep) const;
+    /**
+     * Gathers the unknowns of given dof manager, equivalent to DofManager::giveUnknownVector.
+     * Only the dofs with equation number and without boundary condition are gathered.
+     * @param answer Unknowns of dof manager.
+     * @param dman Number of dof manager in domain.
+     * @param dofIDMask Requested DOF IDs.
+     * @param unknowns Vector of unknowns given by giveDirectUnknownVector.
+     * @param padding Determines if zero value should be inserted for dofs not present in dof manager.
+     * @return False if some of the unknowns could not be gathered directly (answer is then undefined).
+     */
+    bool giveUnknownVector(FloatArray &answer, int dman, const IntArray &dofIDMask, const FloatArray &unknowns, bool padding) const;
+};
+} // end namespace oofem
+#endif // compactdofstore_h
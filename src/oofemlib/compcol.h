@@ -75,6 +75,8 @@
 #include "sparsemtrx.h"
 #include "intarray.h"
 
+#include <vector>
+
 #define _IFT_CompCol_Name "csc"
 
 namespace oofem {
@@ -92,6 +94,16 @@ protected:
     int base;              // index base: offset of first element
     int nz;                // number of nonzeros
 
+    /// Cached positions of a contribution in val, see assembleWithScatterMap.
+    struct ScatterMap {
+        /// Location array the map was computed for.
+        IntArray loc;
+        /// Position in val of each (column-wise) coefficient of the contribution, -1 if not stored.
+        IntArray slots;
+    };
+    /// Scatter maps for each key, empty unless enabled.
+    std :: vector< ScatterMap >scatterMaps;
+
 public:
     /** Constructor. Before any operation an internal profile must be built.
      * @see buildInternalStructure
@@ -112,6 +124,9 @@ public:
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &s) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
+    void enableScatterMaps(int nkeys) override;
+    int assembleWithScatterMap(int key, const IntArray &loc, const FloatMatrix &mat) override;
     bool canBeFactorized() const override { return false; }
     void zero() override;
     double &at(int i, int j) override;
@@ -135,6 +150,16 @@ public:
     const int &col_ptr(int i) const { return colptr[i]; }
 
 protected:
+    /**
+     * Returns the position of a coefficient in the value array.
+     * @param i Row (0-based).
+     * @param j Column (0-based).
+     * @return Position in val, or -1 if the coefficient is not stored by the receiver.
+     */
+    virtual int giveValueIndex(int i, int j) const;
+    /// Drops all cached scatter maps (but keeps them enabled).
+    void resetScatterMaps();
+
     /***********************************/
     /*  General access function (slow) */
     /***********************************/
@@ -95,10 +95,22 @@ public:
     
     virtual void computeContactTangent(SparseMtrx &answer, TimeStep *tStep,
                       const UnknownNumberingScheme &r_s, const UnknownNumberingScheme &c_s); 
+    /**
+     * Updates the contact elements according to the current geometry.
+     * Called at the beginning of each solution step, before the structure of the stiffness matrix is needed.
+     * Default implementation keeps the contact elements given in the input.
+     * @return True if the contact elements have changed (and with them the sparsity pattern).
+     */
+    virtual bool updateContactPairs(TimeStep *tStep) { return false; }
+    /// Returns true if the contact elements are only created by updateContactPairs (none are given in the input).
+    virtual bool requiresContactPairUpdates() { return false; }
     
     ContactElement *giveContactElement(const int num) { return this->masterElementList[num-1]; }
     int giveNumbertOfContactElements() { return this->masterElementList.size(); }
+    /// Adds a contact element, which is then owned by the receiver.
     void addContactElement(ContactElement *cEl) { this->masterElementList.push_back(cEl); }
+    /// Deletes all contact elements.
+    void clearContactElements();
     // objects can be of different kinds
     // nodes, segments, surfaces, analytical functions
     
@@ -81,11 +81,21 @@ public:
     ContactManager &operator = (const ContactManager &src) = delete;
 
     void createContactDofs();
+    /**
+     * Updates the contact pairs of all contact definitions according to the current geometry.
+     * @return True if any contact elements have changed (the sparsity pattern has to be rebuilt).
+     */
+    bool updateContactPairs(TimeStep *tStep);
     
     /// Initializes receiver according to object description stored in input record.
     virtual void initializeFrom(InputRecord &ir);
 
     virtual int instanciateYourself(DataReader &dr);
+    /**
+     * Checks that the engineering model updates the contact pairs if any contact definition requires it.
+     * @return Nonzero if receiver check is o.k.
+     */
+    virtual int checkConsistency();
     virtual const char *giveClassName() const { return "ContactManager"; }
 
     Domain *giveDomain() { return this->domain; }
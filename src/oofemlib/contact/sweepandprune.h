@@ -0,0 +1,110 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef sweepandprune_h
+#define sweepandprune_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+#include <utility>
+
+namespace oofem {
+class FloatArray;
+
+/**
+ * Broad phase of the contact search by sweep and prune.
+ * Objects of two groups (e.g. slave nodes and master segments) are represented by axis aligned bounding boxes,
+ * and all pairs of boxes from different groups which overlap are reported.
+ * The boxes are projected on the coordinate axis with the largest spread of box centers,
+ * and the end points of the intervals are swept in sorted order. The sorted order is kept between
+ * updates and restored by insertion sort, which needs nearly linear time when the boxes move only
+ * a little between subsequent searches (the first search sorts in O(n log n) time).
+ */
+class OOFEM_EXPORT SweepAndPrune
+{
+protected:
+    /// End point of the projection of a box on the sweep axis.
+    struct EndPoint {
+        double value;
+        /// Index of object (objects of the second group follow the first group).
+        int object;
+        bool isMin;
+    };
+
+    /// Number of spatial dimensions.
+    int nsd;
+    /// Number of objects in the first group.
+    int nA;
+    /// Lower and upper corners of boxes, nsd values per object.
+    std :: vector< double >lower, upper;
+    /// End points sorted along the sweep axis.
+    std :: vector< EndPoint >endPoints;
+    /// Sweep axis (0-based).
+    int axis;
+
+public:
+    SweepAndPrune() : nsd(0), nA(0), axis(0) { }
+
+    /**
+     * Sets the number of objects in both groups. The sorted order is discarded if the numbers change.
+     * @param nsd Number of spatial dimensions.
+     * @param nA Number of objects in the first group.
+     * @param nB Number of objects in the second group.
+     */
+    void resize(int nsd, int nA, int nB);
+    /**
+     * Sets the bounding box of an object.
+     * @param group Group of the object (1 or 2).
+     * @param i Object number within group (1-based).
+     * @param lo Lower corner of the box.
+     * @param hi Upper corner of the box.
+     */
+    void setBox(int group, int i, const FloatArray &lo, const FloatArray &hi);
+    /**
+     * Finds all overlapping pairs of boxes from different groups.
+     * @param answer Pairs of object numbers (1-based), first from the first group, second from the second group,
+     * sorted lexicographically.
+     */
+    void findPairs(std :: vector< std :: pair< int, int > > &answer);
+
+protected:
+    /// Returns true if boxes of objects a and b overlap in all directions except the sweep axis.
+    bool overlap(int a, int b) const;
+    /// Chooses the sweep axis and sorts all end points.
+    void initialize();
+};
+} // end namespace oofem
+#endif // sweepandprune_h
@@ -391,9 +391,7 @@ public:
     //@}
 
     /// Set coordinates
-    void setCoordinates(const FloatArray &coords) {
-        this->coordinates = coords;
-    }
+    void setCoordinates(const FloatArray &coords);
     
     /**@name Functions necessary for dof creation. All optional. */
     //@{
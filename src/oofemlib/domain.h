@@ -98,6 +98,7 @@ class FractureManager;
 class oofegGraphicContext;
 class ProcessCommunicator;
 class ContactManager;
+class CompactDofStore;
 /**
  * Class and object Domain. Domain contains mesh description, or if program runs in parallel then it contains
  * description of domain associated to particular processor or thread of execution. Generally, it contain and
@@ -186,6 +187,18 @@ private:
      * because in case of multiple domains stateCounter should be kept independently for each domain.
      */
     StateCounterType nonlocalUpdateStateCounter;
+    /**
+     * Geometry state counter, incremented whenever nodal coordinates change.
+     * Geometry data cached in integration points are valid only for the state they were computed for.
+     */
+    StateCounterType geometryStateCounter;
+    /**
+     * Dof state counter, incremented whenever equation numbers, boundary conditions or the set of dofs change.
+     * The compact dof store is valid only for the state it was built for.
+     */
+    StateCounterType dofStateCounter;
+    /// Compact copy of dof data (created only if requested by engineering model).
+    std :: unique_ptr< CompactDofStore > compactDofStore;
     /// XFEM Manager
     std :: unique_ptr< XfemManager > xfemManager;
 
@@ -454,6 +467,11 @@ public:
     int giveNumberOfSpatialDimensions();
     /// Returns true of axisymmetry is in effect.
     bool isAxisymmetric();
+    /**
+     * Returns true if all material models of the receiver are reentrant (see Material::isReentrant)
+     * and local, so that element contributions can be evaluated concurrently.
+     */
+    bool hasReentrantMaterials();
     /**
      * @name Advanced domain manipulation methods.
      */
@@ -708,6 +726,30 @@ public:
     StateCounterType giveNonlocalUpdateStateCounter() { return this->nonlocalUpdateStateCounter; }
     /// sets the value of nonlocalUpdateStateCounter
     void setNonlocalUpdateStateCounter(StateCounterType val) { this->nonlocalUpdateStateCounter = val; }
+    /// Returns the value of geometryStateCounter
+    StateCounterType giveGeometryStateCounter() const { return this->geometryStateCounter; }
+    /// Marks the geometry of the receiver as changed, invalidating cached geometry data of elements.
+    void incrementGeometryStateCounter()
+    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        this->geometryStateCounter++;
+    }
+    /// Returns the value of dofStateCounter
+    StateCounterType giveDofStateCounter() const { return this->dofStateCounter; }
+    /// Marks the dofs of the receiver as changed, invalidating the compact dof store.
+    void incrementDofStateCounter()
+    {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        this->dofStateCounter++;
+    }
+    /// Returns the compact dof store of receiver, NULL if not used (see EngngModel::useCompactDofStore).
+    CompactDofStore *giveCompactDofStore() { return this->compactDofStore.get(); }
+    /// Builds the compact dof store from the current dofs of receiver, creating the store if needed.
+    void buildCompactDofStore();
 
     void resolveDomainDofsDefaults(const char *);
 
@@ -83,6 +83,7 @@ class IntArray;
 class CrossSection;
 class ElementSide;
 class FEInterpolation;
+class FEICellGeometry;
 class Load;
 class BoundaryLoad;
 class BodyLoad;
@@ -256,6 +257,16 @@ public:
      * @param tStep  Time step when answer is computed.
      */
     virtual void giveCharacteristicMatrix(FloatMatrix &answer, CharType type, TimeStep *tStep);
+    /**
+     * Computes characteristic matrices of a batch of elements of the same type as the receiver at once.
+     * Elements may provide vectorized evaluation of the whole batch, default implementation does nothing.
+     * @param answer Requested characteristic matrices, one for each element in elems.
+     * @param type Id of characteristic component requested.
+     * @param elems Numbers of elements in batch (including the receiver).
+     * @param tStep Time step when answer is computed.
+     * @return True if the matrices have been computed, false if the elements have to be evaluated one by one.
+     */
+    virtual bool giveCharacteristicMatrixBatch(std :: vector< FloatMatrix > &answer, CharType type, const IntArray &elems, TimeStep *tStep) { return false; }
     /**
      * Computes characteristic vector of receiver of requested type in given time step.
      * If element has no capability to compute requested type of characteristic vector
@@ -632,6 +643,25 @@ public:
      * @return Appropriate interpolation, or NULL if none exists.
      */
     virtual FEInterpolation *giveInterpolation(DofIDItem id) const { return giveInterpolation(); }
+    /**
+     * Evaluates the derivatives of shape functions of the element interpolation (see giveInterpolation)
+     * w.r.t. global coordinates at given integration point of the receiver.
+     * If requested by the engineering model (see EngngModel::useGeometryCache), the derivatives and the
+     * transformation jacobian are computed only once and kept in the integration point, until the geometry
+     * of the domain changes (see Domain::giveGeometryStateCounter).
+     * @param answer Shape function derivatives (one row for each node).
+     * @param gp Integration point.
+     * @param cellgeo Geometry of the receiver.
+     */
+    void evaldNdxAt(FloatMatrix &answer, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Evaluates the determinant of the transformation jacobian of the element interpolation at given integration point.
+     * Uses the geometry cache of the integration point if enabled, see evaldNdxAt.
+     * @param gp Integration point.
+     * @param cellgeo Geometry of the receiver.
+     * @return Determinant of the transformation jacobian.
+     */
+    double giveTransformationJacobianAt(GaussPoint *gp, const FEICellGeometry &cellgeo);
     /// @return Reference to the associated material of element.
     virtual Material *giveMaterial();
     /// @return Material number.
@@ -792,6 +822,13 @@ public:
      * for solution steps before is actually casted.
      */
     virtual bool isCast(TimeStep *tStep);
+    /**
+     * Returns true if the stiffness matrix of the receiver is the same in all solution steps,
+     * as long as the activity of the receiver does not change.
+     * Used by linear analyses to reuse the assembled and factorized stiffness matrix.
+     * Default implementation returns false.
+     */
+    virtual bool hasConstantStiffness() { return false; }
 
     // time step initialization (required for some non-linear solvers)
     /**
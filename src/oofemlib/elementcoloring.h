@@ -0,0 +1,98 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef elementcoloring_h
+#define elementcoloring_h
+
+#include "oofemcfg.h"
+#include "intarray.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+
+/**
+ * Partitioning of domain elements into colors, such that no two elements of the same color
+ * share a dof manager (or a master dof manager of any of their slave dofs).
+ * Elements of one color therefore never contribute to the same equation, and their
+ * contributions can be assembled concurrently into sparse matrices and vectors without locking.
+ *
+ * The coloring is computed by a greedy first-fit algorithm in element order.
+ * It assumes that an element contributes only to dofs of its own (and internal) dof managers,
+ * which is how Element::giveLocationArray builds the location array.
+ */
+class OOFEM_EXPORT ElementColoring
+{
+protected:
+    /// Element numbers belonging to each color.
+    std :: vector< IntArray >colors;
+    /// Color of each element (1-based).
+    IntArray elementColor;
+    /// Flag indicating that the coloring is up to date.
+    bool valid;
+
+public:
+    ElementColoring() : colors(), elementColor(), valid(false) { }
+
+    /**
+     * Computes the coloring of all elements in the given domain.
+     * @param d Domain to color.
+     */
+    void buildFrom(Domain *d);
+    /// Invalidates receiver (it will have to be built again before being used).
+    void reset();
+    /// Returns true if receiver has been built and not reset since.
+    bool isValid() const { return valid; }
+
+    /// Returns number of colors.
+    int giveNumberOfColors() const { return (int)colors.size(); }
+    /// Returns the element numbers of all colors.
+    const std :: vector< IntArray > &giveColors() const { return colors; }
+    /// Returns the color (1-based) of given element.
+    int giveElementColor(int ielem) const { return elementColor.at(ielem); }
+
+    /**
+     * Splits a list of (possibly repeated) elements into groups that can be processed concurrently.
+     * The list may interleave element numbers with other data, such as boundary numbers in set boundary lists.
+     * Repeated occurrences of the same element are placed into separate groups.
+     * @param answer Groups of 1-based entry indices into list (entry i refers to list.at((i-1)*stride+1)).
+     * @param list List of element numbers.
+     * @param stride Distance between subsequent element numbers in list.
+     */
+    void splitElementList(std :: vector< IntArray > &answer, const IntArray &list, int stride = 1) const;
+};
+} // end namespace oofem
+#endif // elementcoloring_h
@@ -58,6 +58,7 @@
 #include "exportmodulemanager.h"
 #include "initmodulemanager.h"
 #include "monitormanager.h"
+#include "elementcoloring.h"
 
 #ifdef __PARALLEL_MODE
  #include "parallel.h"
@@ -70,8 +71,13 @@
 //@{
 #define _IFT_EngngModel_nsteps "nsteps"
 #define _IFT_EngngModel_contextoutputstep "contextoutputstep"
+#define _IFT_EngngModel_contextFormat "contextformat"
 #define _IFT_EngngModel_renumberFlag "renumber"
 #define _IFT_EngngModel_profileOpt "profileopt"
+#define _IFT_EngngModel_coloredAssembly "coloredassembly"
+#define _IFT_EngngModel_scatterMaps "scattermaps"
+#define _IFT_EngngModel_geometryCache "geomcache"
+#define _IFT_EngngModel_compactDofStore "compactdofs"
 #define _IFT_EngngModel_nmsteps "nmsteps"
 #define _IFT_EngngModel_nonLinFormulation "nonlinform"
 #define _IFT_EngngModel_eetype "eetype"
@@ -220,8 +226,18 @@ protected:
     IntArray domainPrescribedNeqs;
     /// Renumbering flag (renumbers equations after each step, necessary if Dirichlet BCs change).
     bool renumberFlag;
-    /// Profile optimized numbering flag (using Sloan's algorithm).
-    bool profileOpt;
+    /// Profile optimized numbering mode (0 - none, 1 - Sloan's algorithm, 2 - reverse Cuthill-McKee, 3 - best of both).
+    int profileOpt;
+    /// Lock-free assembly flag; elements are assembled concurrently color by color (OpenMP only).
+    bool coloredAssembly;
+    /// Element colorings used by lock-free assembly, one for each domain.
+    std :: vector< ElementColoring >elementColorings;
+    /// Flag requesting sparse matrices to cache element scatter maps for repeated assembly.
+    bool scatterMaps;
+    /// Flag requesting elements to cache invariant geometry data in integration points.
+    bool geometryCache;
+    /// Flag requesting domains to keep compact copies of dof data for direct gathering of element unknowns.
+    bool compactDofStore;
     /// Equation numbering completed flag.
     int equationNumberingCompleted;
     /// Number of meta steps.
@@ -248,6 +264,8 @@ protected:
     /// Domain context output mode.
     ContextOutputMode contextOutputMode;
     int contextOutputStep;
+    /// Format of context files (0 - plain binary, 1 - chunked container, 2 - compressed chunked container).
+    int contextFormat;
 
     /// Export module manager.
     ExportModuleManager exportModuleManager;
@@ -506,6 +524,16 @@ public:
      * @see Dof::giveUnknown
      */
     virtual double giveUnknownComponent(ValueModeType, TimeStep *, Domain *, Dof *) { return 0.0; }
+    /**
+     * Returns the vector of unknowns indexed by equation numbers, if giveUnknownComponent returns
+     * its component at the equation number of dof for every master dof with equation number.
+     * Allows elements to gather their unknowns directly (see CompactDofStore).
+     * @param mode Mode of unknowns.
+     * @param tStep Time step.
+     * @param d Domain.
+     * @return Vector of unknowns, NULL if not available (default).
+     */
+    virtual const FloatArray *giveDirectUnknownVector(ValueModeType mode, TimeStep *tStep, Domain *d) { return NULL; }
 
     /**
      * Returns the smart pointer to requested field, Null otherwise.
@@ -784,6 +812,14 @@ public:
      * @param stepVersion Version of step.
      */
     std :: string giveContextFileName(int tStepNumber, int stepVersion) const;
+    /**
+     * Opens the context file for the given step and version for reading.
+     * Both plain and chunked (see ChunkedFileDataStream) context files are recognized.
+     * @param tStepNumber Solution step number to restore.
+     * @param stepVersion Version of step.
+     * @exception FileDataStream::CantOpen if the file can't be opened.
+     */
+    std :: unique_ptr< DataStream >giveContextInputStream(int tStepNumber, int stepVersion) const;
     /**
      * Returns the filename for the given domain (used by adaptivity and restore)
      * @param domainNum Domain number.
@@ -893,6 +929,11 @@ public:
      * @todo When all models have converted to using a field, this should be removed.
      */
     virtual bool newDofHandling() { return false; }
+    /**
+     * Returns true if the receiver updates the contact pairs of the contact manager (ContactManager::updateContactPairs)
+     * at the beginning of each solution step. Contact definitions searching for their pairs can only be used in such problems.
+     */
+    virtual bool updatesContactPairs() { return false; }
     /**
      * Returns the parallel context corresponding to given domain (n) and unknown type
      * Default implementation returns i-th context from parallelContextList.
@@ -998,6 +1039,49 @@ public:
     void assembleVectorFromContacts(FloatArray &answer, TimeStep *tStep, CharType type, ValueModeType mode,
                                     const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms = NULL);
 
+    /**
+     * Returns the element coloring of given domain, used for lock-free assembly.
+     * The coloring is built on first request and reset whenever equations are renumbered.
+     * @param d Domain to color.
+     */
+    const ElementColoring &giveElementColoring(Domain *d);
+
+protected:
+    /**
+     * Determines whether element contributions are assembled without locking.
+     * This requires colored assembly to be requested, OpenMP support, and a target that allows concurrent assembly.
+     * @param mtrx Target sparse matrix, or NULL when assembling vectors.
+     */
+    bool useLockFreeAssembly(const SparseMtrx *mtrx) const;
+    /**
+     * Determines whether the element contributions (and thus the material updates) of given domain can be
+     * evaluated concurrently. This requires OpenMP support and reentrant materials (see Material::isReentrant).
+     * @param d Domain.
+     */
+    bool useConcurrentElementEvaluation(Domain *d) const;
+    /**
+     * Splits elements into groups which are assembled one after another, with the elements of each group assembled in parallel.
+     * For lock-free assembly, groups follow the element coloring, otherwise a single group is returned.
+     * @param answer Groups of indices into the element list.
+     * @param d Domain of the elements.
+     * @param list Element list (possibly with interleaved boundary numbers), or NULL for all elements in domain (then indices are element numbers).
+     * @param stride Distance between element numbers in list.
+     * @param lockFree Whether the groups are used for lock-free assembly.
+     */
+    void giveAssemblyGroups(std :: vector< IntArray > &answer, Domain *d, const IntArray *list, int stride, bool lockFree);
+    /**
+     * Assembles a single element contribution into the given vector.
+     * @param answer Assembled vector.
+     * @param norms Squared norms per dof id (thread local).
+     * @param charVec Element contribution.
+     * @param loc Location array.
+     * @param dofids Dof ids of contribution.
+     * @param computeNorms Whether to add to norms.
+     * @param lockFree If false, writes to answer are serialized.
+     */
+    void assembleVectorFromElement(FloatArray &answer, FloatArray &norms, const FloatArray &charVec,
+                                   const IntArray &loc, const IntArray &dofids, bool computeNorms, bool lockFree);
+
 protected:
     /**
      * Packs receiver data when rebalancing load. When rebalancing happens, the local numbering will be lost on majority of processors.
@@ -1094,6 +1178,16 @@ public:
      * is done, or on element level, when non linear contributions are computed.
      */
     virtual fMode giveFormulation() { return nonLinFormulation; }
+    /**
+     * Returns true if elements should keep the shape function derivatives and jacobians in their integration
+     * points instead of recomputing them in every evaluation (see Element::evaldNdxAt).
+     */
+    bool useGeometryCache() const { return geometryCache; }
+    /**
+     * Returns true if domains should keep compact copies of their dof data, which allow elements to gather
+     * their unknowns directly from the vector of unknowns (see Element::computeVectorOf).
+     */
+    bool useCompactDofStore() const { return compactDofStore; }
     /*
      * Returns Load Response Mode of receiver.
      * This value indicates, whether nodes and elements should assemble
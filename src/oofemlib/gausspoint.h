@@ -46,7 +46,9 @@
 #include "integrationpointstatus.h"
 #include "element.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
 #include "materialmode.h"
+#include "statecountertype.h"
 
 namespace oofem {
 class Material;
@@ -56,6 +58,19 @@ class FiberedCrossSection;
 class CrossSection;
 class IntegrationRule;
 
+/**
+ * Geometry data of integration point, which remain constant as long as the nodal coordinates do not change.
+ * Kept by integration points on request, see Element::evaldNdxAt.
+ */
+struct GaussPointGeometryCache {
+    /// Derivatives of element shape functions w.r.t. global coordinates.
+    FloatMatrix dNdx;
+    /// Determinant of the transformation jacobian.
+    double detJ = 0.;
+    /// Geometry state of domain the data have been computed for (see Domain::giveGeometryStateCounter).
+    StateCounterType geometryState = -1;
+};
+
 /**
  * Class representing integration point in finite element program.
  * Integration point maintain its space position, integration
@@ -107,6 +122,8 @@ private:
     double weight;
     /// Material mode of receiver.
     MaterialMode materialMode;
+    /// Optional cache of geometry data.
+    std::unique_ptr<GaussPointGeometryCache> geometryCache;
 
 protected:
     // layer and fibered material support
@@ -135,7 +152,7 @@ public:
     double giveNaturalCoordinate(int i) const { return naturalCoordinates.at(i); }
     /// Returns coordinate array of receiver.
     const FloatArray &giveNaturalCoordinates() const { return naturalCoordinates; }
-    void setNaturalCoordinates(const FloatArray &c) { naturalCoordinates = c; }
+    void setNaturalCoordinates(const FloatArray &c) { naturalCoordinates = c; geometryCache = nullptr; }
 
     /// Returns local sub-patch coordinates of the receiver
     const FloatArray &giveSubPatchCoordinates() const
@@ -175,6 +192,15 @@ public:
         }
     }
 
+    /// Returns the geometry cache of receiver, it is created on first request.
+    GaussPointGeometryCache &giveGeometryCache()
+    {
+        if ( !geometryCache ) {
+            geometryCache = std::make_unique<GaussPointGeometryCache>();
+        }
+        return *geometryCache;
+    }
+
     /// Returns  integration weight of receiver.
     double giveWeight() { return weight; }
     void setWeight(double w) { weight = w; }
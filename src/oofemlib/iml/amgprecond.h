@@ -0,0 +1,189 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef amgprecond_h
+#define amgprecond_h
+
+#include "precond.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+#include "intarray.h"
+#include "skyline.h"
+
+#include <memory>
+#include <vector>
+
+///@name Input fields for AMGPreconditioner
+//@{
+#define _IFT_AMGPreconditioner_levels "amglevels"
+#define _IFT_AMGPreconditioner_coarsesize "amgcoarse"
+#define _IFT_AMGPreconditioner_theta "amgtheta"
+#define _IFT_AMGPreconditioner_sweeps "amgsweeps"
+//@}
+
+namespace oofem {
+class Domain;
+class CompCol;
+class UnknownNumberingScheme;
+
+/**
+ * Smoothed aggregation algebraic multigrid preconditioner for symmetric positive definite matrices,
+ * applied as one V-cycle with damped Jacobi smoothing.
+ * Vanek, P., Mandel, J., Brezina, M.: Algebraic multigrid by smoothed aggregation for second and fourth order
+ * elliptic problems, Computing 56, 179-196, 1996.
+ *
+ * The equations are aggregated node by node, using the strong connections of the matrix.
+ * The tentative prolongator interpolates the near-nullspace exactly; for structural problems the near-nullspace
+ * are the rigid body modes, computed from the dof manager coordinates (see initNearNullspace).
+ * Without near-nullspace, every equation is a node and constant vector is used.
+ * Coarsening stops when the number of equations drops below given size; the coarsest problem is solved directly
+ * by skyline LDL factorization.
+ */
+class OOFEM_EXPORT AMGPreconditioner : public Preconditioner
+{
+protected:
+    /// Compressed sparse row matrix used on the multigrid levels.
+    struct CSRMatrix {
+        int nRows = 0;
+        int nColumns = 0;
+        IntArray rowptr;
+        IntArray colind;
+        FloatArray val;
+
+        /// Computes y = A.x.
+        void times(const FloatArray &x, FloatArray &y) const;
+    };
+
+    /// Multigrid level.
+    struct Level {
+        /// Matrix of the level.
+        CSRMatrix A;
+        /// Prolongator from the next (coarser) level.
+        CSRMatrix P;
+        /// Restriction to the next level (transposed prolongator).
+        CSRMatrix R;
+        /// Inverted diagonal of A.
+        FloatArray invDiag;
+        /// Damping of Jacobi smoother (and prolongator smoothing).
+        double omega;
+    };
+
+    /// Multigrid levels, the last one is the coarsest.
+    std :: vector< Level >levels;
+    /// Factorized matrix of the coarsest level (if solved directly).
+    std :: unique_ptr< Skyline >coarseMatrix;
+
+    /// Near-nullspace vectors (columns) of the finest level.
+    FloatMatrix nullspace;
+    /// Node (0-based) of each equation of the finest level.
+    IntArray eqNodes;
+
+    /// Maximal number of levels.
+    int maxLevels;
+    /// Number of equations under which the problem is solved directly.
+    int coarseSize;
+    /// Threshold for strong connections.
+    double theta;
+    /// Number of pre- and post-smoothing sweeps.
+    int sweeps;
+
+public:
+    /// Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+    AMGPreconditioner();
+    /// Destructor.
+    virtual ~AMGPreconditioner() { }
+
+    void init(const SparseMtrx &a) override;
+
+    /**
+     * Sets the near-nullspace of the matrix.
+     * @param b Near-nullspace vectors stored in columns (one row for each equation).
+     * @param nodes Node (0-based) of each equation; equations of the same node are always aggregated together.
+     */
+    void setNearNullspace(const FloatMatrix &b, const IntArray &nodes);
+    /**
+     * Computes the rigid body modes from the coordinates of dof managers in given domain,
+     * for equations in given numbering. Displacement and rotation dofs contribute to translations
+     * and rotations, other dof types have constant vector per dof type.
+     * @param d Domain.
+     * @param s Numbering of the equations of the matrix.
+     */
+    void initNearNullspace(Domain *d, const UnknownNumberingScheme &s);
+
+    void solve(const FloatArray &rhs, FloatArray &solution) const override;
+    void trans_solve(const FloatArray &rhs, FloatArray &solution) const override { this->solve(rhs, solution); }
+
+    const char *giveClassName() const override { return "AMG"; }
+    void initializeFrom(InputRecord &ir) override;
+
+protected:
+    /// Converts the given matrix to full (not only triangular) compressed rows.
+    void convert(CSRMatrix &answer, const CompCol &a, bool lowerOnly) const;
+    /**
+     * Aggregates the nodes of given level.
+     * @param aggr Aggregate of each node (0-based).
+     * @param A Matrix.
+     * @param nodes Node of each equation.
+     * @param nnodes Number of nodes.
+     * @return Number of aggregates.
+     */
+    int aggregate(IntArray &aggr, const CSRMatrix &A, const IntArray &nodes, int nnodes) const;
+    /**
+     * Builds the tentative prolongator by orthonormalization of the near-nullspace on each aggregate.
+     * @param P Tentative prolongator.
+     * @param coarseB Near-nullspace on the coarse level.
+     * @param coarseNodes Aggregate (node of coarse level) of each coarse equation.
+     * @param B Near-nullspace.
+     * @param nodes Node of each equation.
+     * @param aggr Aggregate of each node.
+     * @param naggr Number of aggregates.
+     */
+    void buildTentativeProlongator(CSRMatrix &P, FloatMatrix &coarseB, IntArray &coarseNodes, const FloatMatrix &B,
+                                   const IntArray &nodes, const IntArray &aggr, int naggr) const;
+    /// Estimates the spectral radius of D^-1.A by power iterations.
+    double estimateSpectralRadius(const CSRMatrix &A, const FloatArray &invDiag) const;
+    /// Computes the product C = A.B.
+    static void multiply(CSRMatrix &C, const CSRMatrix &A, const CSRMatrix &B);
+    /// Computes the transposition T = A^T.
+    static void transpose(CSRMatrix &T, const CSRMatrix &A);
+    /// Performs one V-cycle on given level.
+    void vcycle(int lev, const FloatArray &b, FloatArray &x) const;
+    /// Factorizes the matrix of the coarsest level in skyline storage.
+    void factorizeCoarseMatrix(const CSRMatrix &A);
+    /// Performs damped Jacobi sweeps on given level.
+    void smooth(const Level &l, const FloatArray &b, FloatArray &x, bool zeroGuess) const;
+};
+} // end namespace oofem
+#endif // amgprecond_h
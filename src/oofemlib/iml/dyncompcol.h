@@ -82,6 +82,7 @@ public:
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
     bool canBeFactorized() const override { return false; }
     void zero() override;
     const char* giveClassName() const override { return "DynCompCol"; }
@@ -66,7 +66,7 @@ private:
     /// Solver type.
     enum IMLSolverType { IML_ST_CG, IML_ST_GMRES };
     /// Preconditioner type.
-    enum IMLPrecondType { IML_VoidPrec, IML_DiagPrec, IML_ILU_CompColPrec, IML_ILU_CompRowPrec, IML_ICPrec };
+    enum IMLPrecondType { IML_VoidPrec, IML_DiagPrec, IML_ILU_CompColPrec, IML_ILU_CompRowPrec, IML_ICPrec, IML_AMGPrec };
 
     /// Last mapped Lhs matrix
     SparseMtrx *lhs;
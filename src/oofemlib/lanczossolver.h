@@ -0,0 +1,86 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef lanczossolver_h
+#define lanczossolver_h
+
+#include "sparsegeneigenvalsystemnm.h"
+#include "linsystsolvertype.h"
+
+#define _IFT_LanczosSolver_Name "lanczos"
+#define _IFT_LanczosSolver_shift "eigshift"
+#define _IFT_LanczosSolver_maxdim "lanczosdim"
+#define _IFT_LanczosSolver_nitem "lanczosit"
+
+namespace oofem {
+class Domain;
+class EngngModel;
+
+/**
+ * Shift-invert thick restart Lanczos solver of the generalized eigen value problem
+ * @f$ A v = \lambda B v @f$.
+ *
+ * The Lanczos process is applied to the operator @f$ (A - \sigma B)^{-1} B @f$, which is self-adjoint
+ * in the inner product induced by the shifted matrix @f$ A - \sigma B @f$. The shifted matrix
+ * is factorized only once (by the linear solver selected by "lstype") and each Lanczos step
+ * requires one back substitution and one product with B. Only the shifted matrix has to be
+ * positive definite, B may be indefinite (as the initial stress matrix in linear stability analysis).
+ * Eigen values closest to the shift are found. The basis is kept fully orthogonal and the size of the
+ * Krylov subspace is limited; when it is exhausted, the process is restarted from the wanted Ritz vectors.
+ *
+ * Eigen vectors are normalized so that @f$ |v^T B v| = 1 @f$.
+ */
+class OOFEM_EXPORT LanczosSolver : public SparseGeneralEigenValueSystemNM
+{
+private:
+    /// Shift.
+    double shift;
+    /// Max dimension of Krylov subspace (zero means default based on number of required eigen values).
+    int maxdim;
+    /// Max number of restarts.
+    int nitem;
+    /// Linear solver used for the shifted matrix.
+    LinSystSolverType linSolverType;
+
+public:
+    LanczosSolver(Domain * d, EngngModel * m);
+    virtual ~LanczosSolver() {}
+
+    void initializeFrom(InputRecord &ir) override;
+    NM_Status solve(SparseMtrx &A, SparseMtrx &B, FloatArray &x, FloatMatrix &v, double rtol, int nroot) override;
+    const char *giveClassName() const override { return "LanczosSolver"; }
+};
+} // end namespace oofem
+#endif // lanczossolver_h
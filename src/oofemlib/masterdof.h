@@ -148,9 +148,9 @@ public:
     void saveContext(DataStream &stream, ContextMode mode) override;
     void restoreContext(DataStream &stream, ContextMode mode) override;
 
-    void setBcId(int bcId) override { this->bc = bcId; }
+    void setBcId(int bcId) override;
     void setIcId(int icId) override { this->ic = icId; }
-    void setEquationNumber(int newEquationNumber) override { this->equationNumber = newEquationNumber; }
+    void setEquationNumber(int newEquationNumber) override;
     Dictionary *giveUnknowns() override { return &this->unknowns; }
     int giveEqn() override { return equationNumber; }
 
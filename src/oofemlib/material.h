@@ -132,6 +132,23 @@ public:
      * Default implementation returns true.
      */
     virtual bool isCharacteristicMtrxSymmetric(MatResponseMode rMode) const { return true; }
+    /**
+     * Returns true if the receiver can be evaluated concurrently in different integration points.
+     * A reentrant material model has no mutable state and no shared temporaries; when evaluating
+     * the response in an integration point, it only modifies the temporary variables of the status
+     * belonging to that integration point (the committed state is only changed by updateYourself).
+     * Element contributions are evaluated in parallel only if all materials of the domain are reentrant.
+     * Default implementation returns false; material models declare themselves reentrant after being audited.
+     */
+    virtual bool isReentrant() const { return false; }
+    /**
+     * Returns true if the stiffness of the receiver depends neither on time nor on the
+     * state of the integration point (strain, internal variables, temperature).
+     * Linear analyses then keep the assembled and factorized stiffness matrix between solution steps
+     * as long as all elements report constant stiffness, see Element::hasConstantStiffness.
+     * Default implementation returns false.
+     */
+    virtual bool hasConstantStiffness() const { return false; }
     /**
      * Returns the value of material property 'aProperty'. Property must be identified
      * by unique int id. Integration point also passed to allow for materials with spatially
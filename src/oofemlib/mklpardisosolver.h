@@ -36,6 +36,8 @@
 #define mklpardisosolver_h
 
 #include "sparselinsystemnm.h"
+#include "sparsemtrx.h"
+#include "intarray.h"
 
 #define _IFT_MKLPardisoSolver_Name "mklpardiso"
 
@@ -45,11 +47,30 @@ namespace oofem {
  * Implements the solution of linear system of equation in the form @f$ A\cdot x=b @f$ using solvers
  * from MKL Pardiso. It will not work with Pardiso 5.0.
  * Only works with the CSC (compressed sparse column) sparse matrix implementation.
+ * The factorization is kept until the matrix (or its version) changes, so repeated solutions
+ * with the same matrix only perform the back substitution.
  * 
  * @author Mikael Öhman
  */
 class OOFEM_EXPORT MKLPardisoSolver : public SparseLinearSystemNM
 {
+private:
+    /// Internal solver memory pointer.
+    void *pt [ 64 ];
+    /// Pardiso control parameters.
+    IntArray iparm; ///@todo pardisoinit seems to write outside this array
+    /// Pardiso matrix type of the factorization.
+    int mtype;
+    /// Number of equations of the factorization.
+    int neqs;
+    /// Last factorized LHS matrix.
+    SparseMtrx *Lhs;
+    /// Last factorized matrix version.
+    SparseMtrx :: SparseMtrxVersionType lhsVersion;
+
+    /// Releases the internal memory of the factorization.
+    void releaseFactorization();
+
 public:
     /**
      * Constructor.
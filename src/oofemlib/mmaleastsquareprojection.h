@@ -37,8 +37,12 @@
 
 #include "materialmappingalgorithm.h"
 #include "interface.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
 
-#include <list>
+#include <map>
+#include <memory>
+#include <vector>
 
 ///@name Input fields for MMALeastSquareProjection
 //@{
@@ -54,12 +58,6 @@ class TimeStep;
 class DynamicInputRecord;
 
 enum MMALeastSquareProjectionPatchType { MMALSPPatchType_1dq, MMALSPPatchType_2dq };
-/*
- * Defines, whether only the necessary number of closest points will be used
- * to fit a polynomial. If not defined, more points from gp neighborhood will
- * be used, based on element connectivity.
- */
-//#define MMALSP_ONLY_CLOSEST_POINTS
 
 /**
  * The class implements the transfer of state variables based on
@@ -71,23 +69,51 @@ enum MMALeastSquareProjectionPatchType { MMALSPPatchType_1dq, MMALSPPatchType_2d
  * -# The least square fit is done
  * -# Value in point of interest is evaluated.
  *
+ * The patch and the least square fit depend only on the source element, so they are constructed once
+ * for all points with the same source element and cached until finish is called. The fit is expressed
+ * as weights of patch integration points for each point of interest, so all variables are mapped
+ * by the same weights.
+ *
  * It is obvious, that this mapper operates locally and therefore there is no need to declared this
  * mapper as static material member.
- *
+ * For mapping to many points at once, __initPoints and __mapVariables process all points in parallel.
  */
 class OOFEM_EXPORT MMALeastSquareProjection : public MaterialMappingAlgorithm
 {
 protected:
+    /// Patch of integration points with least square fit.
+    struct Patch {
+        /// Integration points of patch, empty if there are not enough points in neighbourhood.
+        std :: vector< GaussPoint * >gps;
+        /// Type of patch.
+        MMALeastSquareProjectionPatchType type;
+        /// Origin of polynomial (centroid of patch points).
+        FloatArray center;
+        /// Polynomial coefficients due to unit values in patch points (one column per point).
+        FloatMatrix coeffs;
+    };
+    /// Mapping data of point of interest.
+    struct PointRecord {
+        std :: shared_ptr< Patch >patch;
+        /// Weights of patch points.
+        FloatArray weights;
+        /// Closest integration point, used instead of patch if the patch is empty.
+        GaussPoint *closestIP = nullptr;
+    };
+
     /// If set, then only IP in the neighbourhood with same state can be used to interpolate the values.
     int stateFilter;
     /// If set, then only IP in the same region are taken into account.
     int regionFilter;
-    /// List of Gp participating in patch.
-    std :: list< GaussPoint * >patchGPList;
     /// Patch domain.
     Domain *patchDomain;
-    /// Type of patch.
-    MMALeastSquareProjectionPatchType patchType;
+    /// Patches already constructed, identified by source element set and source element number.
+    std :: map< std :: pair< const Set *, int >, std :: shared_ptr< Patch > >patchCache;
+    /// Point of last __init.
+    PointRecord current;
+    /// Points of last __initPoints.
+    std :: vector< PointRecord >points;
+
 public:
     /// Constructor
     MMALeastSquareProjection();
@@ -100,6 +126,23 @@ public:
 
     int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep) override;
 
+    /**
+     * Initializes the receiver for a set of points at once. The points are processed in parallel.
+     * @param dold Old domain.
+     * @param coords Coordinates of points.
+     * @param sourceElemSets Sets of source elements, one for each point.
+     * @param tStep Time step.
+     */
+    void __initPoints(Domain *dold, const std :: vector< FloatArray > &coords, const std :: vector< Set * > &sourceElemSets, TimeStep *tStep);
+    /**
+     * Maps the variable to all points of last __initPoints.
+     * @param answer Values in points.
+     * @param type Determines the type of internal variable.
+     * @param tStep Time step.
+     * @return Nonzero if o.k.
+     */
+    int __mapVariables(std :: vector< FloatArray > &answer, InternalStateType type, TimeStep *tStep);
+
     int mapStatus(MaterialStatus &oStatus) const override;
 
     void initializeFrom(InputRecord &ir) override;
@@ -111,6 +154,14 @@ public:
 protected:
     void computePolynomialTerms(FloatArray &P, const FloatArray &coords, MMALeastSquareProjectionPatchType type);
     int giveNumberOfUnknownPolynomialCoefficients(MMALeastSquareProjectionPatchType regType);
+    /// Sets up the search structures of old domain, which are then shared by all threads.
+    void prepare(Domain *dold);
+    /// Finds (or constructs) the patch of point and computes the weights of patch points.
+    void initPoint(PointRecord &point, const FloatArray &coords, Set &elemSet, TimeStep *tStep);
+    /// Constructs the patch around source element and computes the least square fit.
+    std :: shared_ptr< Patch >givePatch(Element *sourceElement, Set &elemSet, TimeStep *tStep);
+    /// Evaluates the variable in point from the values in patch points.
+    void mapPoint(FloatArray &answer, const PointRecord &point, InternalStateType type, TimeStep *tStep);
 };
 } // end namespace oofem
 #endif // mmaleastsquareprojection_h
@@ -38,12 +38,15 @@
 #include "matstatus.h"
 #include "interface.h"
 #include "intarray.h"
+#include "floatarray.h"
 #include "grid.h"
 #include "mathfem.h"
 #include "dynamicinputrecord.h"
+#include "statecountertype.h"
 
 #include <list>
 #include <memory>
+#include <vector>
 
 ///@name Input fields for NonlocalMaterialExtensionInterface
 //@{
@@ -256,6 +259,35 @@ protected:
     /// Parameter specifying how the weight function should be adjusted due to damage.
     int averType = 0;
 
+    /**
+     * Uniform grid of cells (cell list) with the integration points of the domain, used for the search
+     * of interacting points when the nonlocal tables are built. The coordinates and volumes of the integration
+     * points are evaluated only once, when the cell list is built.
+     */
+    struct IPCellList {
+        /// Global coordinates of the integration points, ordered by elements.
+        std :: vector< FloatArray >coords;
+        /// Volumes around the integration points.
+        std :: vector< double >volumes;
+        /// Elements owning the integration points.
+        std :: vector< int >elements;
+        /// Position of the first integration point of each element.
+        std :: vector< int >elementOffsets;
+        /// Integration points sorted by cells, with cellOffsets pointing to the first point of each cell.
+        std :: vector< int >cellIps, cellOffsets;
+        /// Origin of the grid.
+        FloatArray origin;
+        /// Cell size.
+        double cellSize = 0.;
+        /// Number of cells in each direction.
+        int ncells [ 3 ] = { 1, 1, 1 };
+        /// Number of elements and geometry state of the domain the cell list has been built for.
+        int nelem = 0;
+        StateCounterType geometryState = 0;
+    };
+    /// Cell list of the integration points, built when the first nonlocal table is requested.
+    mutable std :: unique_ptr< IPCellList >ipCellList;
+
 public:
     /**
      * Constructor. Creates material with given number, belonging to given domain.
@@ -425,6 +457,29 @@ protected:
 
     void applyBarrierConstraints(const FloatArray &gpCoords, const FloatArray &jGpCoords, double &weight) const;
 
+    /**
+     * Computes the list of integration points which take part in nonlocal average in given integration point.
+     * Integration points are searched in the cell list, which has to be up to date.
+     */
+    void computeNonlocalPointTable(GaussPoint *gp, NonlocalMaterialStatusExtensionInterface *statusExt) const;
+    /**
+     * Builds the cell list with the integration points of the domain.
+     * @return True if the cell list was built, false if the existing one is up to date.
+     */
+    bool buildIPCellList() const;
+    /**
+     * Computes the nonlocal tables of all integration points of the receiver which have not been built yet.
+     * The tables are computed in parallel if OpenMP is available.
+     */
+    void buildAllNonlocalPointTables() const;
+    /**
+     * Finds elements with at least one integration point within given distance from given point.
+     * @param elemSet Sorted list of found elements.
+     * @param coords Coordinates of the point.
+     * @param radius Search radius.
+     */
+    void giveElementsWithIPWithinRadius(IntArray &elemSet, const FloatArray &coords, double radius) const;
+
     /**
      * Manipulates weight on integration point in the element.
      * By default is off, keyword 'averagingtype' specifies various methods.
@@ -0,0 +1,82 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef oofembindatareader_h
+#define oofembindatareader_h
+
+#include "datareader.h"
+#include "oofembininputrecord.h"
+
+#include <string>
+#include <vector>
+
+namespace oofem {
+/**
+ * Class representing the reader of OOFEM binary input files.
+ * The binary file contains the same records as the text input file (with included files expanded
+ * and comments removed), with the numerical fields stored in typed form (see OOFEMBinInputRecord),
+ * so that no tokenizing or conversion of numbers is needed when the problem is instanciated.
+ * Binary files are created from the text input files by convert (see oofem option -cb).
+ */
+class OOFEM_EXPORT OOFEMBinDataReader : public DataReader
+{
+protected:
+    std :: string dataSourceName;
+    std :: vector< OOFEMBinInputRecord > recordList;
+
+    /// Keeps track of the current position in the list
+    std :: vector< OOFEMBinInputRecord > :: iterator it;
+
+public:
+    /// Constructor.
+    OOFEMBinDataReader(std :: string inputfilename);
+    virtual ~OOFEMBinDataReader();
+
+    InputRecord &giveInputRecord(InputRecordType typeId, int recordId) override;
+    bool peakNext(const std :: string &keyword) override;
+    void finish() override;
+    std :: string giveReferenceName() const override { return dataSourceName; }
+
+    /// Returns true if given file is an OOFEM binary input file.
+    static bool isBinaryFile(const std :: string &fileName);
+    /**
+     * Converts OOFEM text input file to binary input file.
+     * @param inputFileName Name of the text input file.
+     * @param outputFileName Name of the binary file to create.
+     */
+    static void convert(const std :: string &inputFileName, const std :: string &outputFileName);
+};
+} // end namespace oofem
+#endif // oofembindatareader_h
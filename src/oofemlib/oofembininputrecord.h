@@ -0,0 +1,132 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef oofembininputrecord_h
+#define oofembininputrecord_h
+
+#include "oofemtxtinputrecord.h"
+
+#include <string>
+#include <vector>
+
+namespace oofem {
+/**
+ * Class representing the Input Record for OOFEM binary input file format.
+ * Records consisting only of the keyword, number and fields with numerical values (typically nodes,
+ * elements, sets and most of the material and cross section records) are stored in typed form: field names
+ * with arrays of already converted values. Such fields are given without any tokenizing or string
+ * conversion. The remaining records, and fields of types not available in typed form, are handled as text
+ * records by the parent class.
+ */
+class OOFEM_EXPORT OOFEMBinInputRecord : public OOFEMTXTInputRecord
+{
+protected:
+    /// True if the record is stored in typed form.
+    bool typed;
+    /// True if the record string of parent class has been set from the typed form.
+    bool textInitialized;
+
+    /// Record keyword.
+    std :: string keyword;
+    /// Record number (valid if hasNumber is set).
+    int number;
+    bool hasNumber;
+
+    /// Field names.
+    std :: vector< std :: string >fieldNames;
+    /// Position of the first value of each field in values, terminated by the total number of values.
+    std :: vector< int >fieldOffsets;
+    /// Values of all fields.
+    std :: vector< double >values;
+    /// Flags indicating that the value was given as an integer.
+    std :: vector< bool >integerFlags;
+    /// Flags indicating that the field has been read.
+    std :: vector< bool >fieldReadFlags;
+
+public:
+    /// Constructor. Creates an empty input record.
+    OOFEMBinInputRecord();
+
+    std::unique_ptr<InputRecord> clone() const override { return std::make_unique<OOFEMBinInputRecord>(*this); }
+
+    /**
+     * Converts given text record into typed form, if possible.
+     * @return True if the record is stored in typed form, false if it is kept as text.
+     */
+    bool setRecordFromText(int lineNumber, const std :: string &text);
+    /**
+     * Writes the record to binary stream.
+     */
+    void write(std :: ostream &stream) const;
+    /**
+     * Reads the record from binary buffer.
+     * @param buffer Buffer with the content of binary file.
+     * @param pos Position of the record, on return position of the next record.
+     * @return False if the buffer ends prematurely.
+     */
+    bool read(const std :: string &buffer, std :: size_t &pos);
+
+    std :: string giveRecordAsString() const override;
+    void finish(bool wrn = true) override;
+
+    void giveRecordKeywordField(std :: string &answer, int &value) override;
+    void giveRecordKeywordField(std :: string &answer) override;
+    void giveField(int &answer, InputFieldType id) override;
+    void giveField(double &answer, InputFieldType id) override;
+    void giveField(bool &answer, InputFieldType id) override;
+    void giveField(std :: string &answer, InputFieldType id) override;
+    void giveField(FloatArray &answer, InputFieldType id) override;
+    void giveField(IntArray &answer, InputFieldType id) override;
+    void giveField(FloatMatrix &answer, InputFieldType id) override;
+    void giveField(std :: vector< std :: string > &answer, InputFieldType id) override;
+    void giveField(Dictionary &answer, InputFieldType id) override;
+    void giveField(std :: list< Range > &answer, InputFieldType id) override;
+    void giveField(ScalarFunction &answer, InputFieldType id) override;
+
+    bool hasField(InputFieldType id) override;
+    void printYourself() override;
+
+protected:
+    /// Returns the index of given field, or -1 if not found.
+    int giveFieldIndx(const char *kwd) const;
+    /// Returns the index of given field and marks it as read, throws exception if not found.
+    int giveRequiredFieldIndx(const char *kwd);
+    /// Sets the record string of parent class, so that it can read the fields not available in typed form.
+    void initializeText();
+    /// Sets the keyword and number of typed record from its first field.
+    void setKeywordFromFields();
+};
+} // end namespace oofem
+#endif // oofembininputrecord_h
@@ -39,6 +39,8 @@
 #include "oofemtxtinputrecord.h"
 
 #include <fstream>
+#include <string>
+#include <vector>
 
 namespace oofem {
 /**
@@ -48,19 +50,21 @@ namespace oofem {
  * There is no check for record type requested, it is assumed that records are
  * written in correct order, which determined by the coded sequence of
  * component initialization and described in input manual.
+ * The whole file is read at once and records are tokenized in parallel when OpenMP is available.
  */
 class OOFEM_EXPORT OOFEMTXTDataReader : public DataReader
 {
 protected:
     std :: string dataSourceName;
-    std :: list< OOFEMTXTInputRecord > recordList;
+    std :: vector< OOFEMTXTInputRecord > recordList;
 
     /// Keeps track of the current position in the list
-    std :: list< OOFEMTXTInputRecord > :: iterator it;
+    std :: vector< OOFEMTXTInputRecord > :: iterator it;
 
 public:
     /// Constructor.
     OOFEMTXTDataReader(std :: string inputfilename);
+    /// Copy constructor. Copies the parsed records, which are then read from the beginning (the file is not read again).
     OOFEMTXTDataReader(const OOFEMTXTDataReader & x);
     virtual ~OOFEMTXTDataReader();
 
@@ -69,14 +73,19 @@ public:
     void finish() override;
     std :: string giveReferenceName() const override { return dataSourceName; }
 
+    /// The binary reader converts the records of text input files.
+    friend class OOFEMBinDataReader;
+
 protected:
+    /// Reads the whole content of given file into buffer.
+    static void readFile(const std :: string &fileName, std :: string &buffer);
     /**
-     * Reads one line from inputStream
+     * Reads one line from buffer, starting at given position.
      * Parts within quotations have case preserved.
      */
-    bool giveLineFromInput(std :: ifstream &stream, int &lineNum, std :: string &line);
-    /// Reads one line from stream.
-    bool giveRawLineFromInput(std :: ifstream &stream, int &lineNum, std :: string &line);
+    bool giveLineFromInput(const std :: string &buffer, std :: size_t &pos, int &lineNum, std :: string &line);
+    /// Reads one line from buffer, starting at given position.
+    bool giveRawLineFromInput(const std :: string &buffer, std :: size_t &pos, int &lineNum, std :: string &line);
 };
 } // end namespace oofem
 #endif // oofemtxtdatareader_h
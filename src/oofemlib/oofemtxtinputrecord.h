@@ -39,7 +39,9 @@
 #include "tokenizer.h"
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <unordered_map>
 
 namespace oofem {
 /**
@@ -56,6 +58,11 @@ protected:
      */
     Tokenizer tokenizer;
     std :: vector< bool >readFlag;
+    /**
+     * Position of the first occurrence of tokens starting with a letter (i.e. possible keywords),
+     * built on demand for long records only, where it replaces the linear search.
+     */
+    std :: unordered_map< std :: string_view, int >keywordIndex;
 
     /// Record representation.
     std :: string record;
@@ -101,6 +108,8 @@ public:
     void printYourself() override;
 
     void setLineNumber(int lineNumber) { this->lineNumber = lineNumber; }
+    /// Returns the line number of the record in input file.
+    int giveLineNumber() const { return this->lineNumber; }
 
 protected:
     int giveKeywordIndx(const char *kwd);
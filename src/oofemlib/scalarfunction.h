@@ -38,6 +38,7 @@
 #include "parser.h"
 #include "error.h"
 #include "gausspoint.h"
+#include "contextioresulttype.h"
 
 #include <string>
 #include <map>
@@ -46,6 +47,7 @@ namespace oofem {
 class FunctionArgument;
 class Domain;
 class FloatArray;
+class DataStream;
 
 /**
  * Implementation of Scalar function. The scalar function can be defined as
@@ -139,6 +141,11 @@ public:
      */
     bool isDefined() const;
 
+    /// Writes the receiver (its type and value, expression or function reference) into the stream.
+    contextIOResultType storeYourself(DataStream &stream) const;
+    /// Reads the receiver from the stream.
+    contextIOResultType restoreYourself(DataStream &stream);
+
     friend std :: ostream &operator << ( std :: ostream & out, const ScalarFunction & s );
 };
 } // end namespace OOFEM
@@ -39,6 +39,9 @@
 
 #define _IFT_Skyline_Name "skyline"
 
+/// Default number of columns in one panel of blocked factorization.
+#define Skyline_FACTORIZATION_PANEL 64
+
 namespace oofem {
 /**
  * Class implementing sparse matrix stored in skyline form. This class
@@ -103,9 +106,24 @@ public:
 
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
 
     bool canBeFactorized() const override { return true; }
     SparseMtrx *factorized() override;
+    /**
+     * Factorizes the receiver to U(T).D.U form column by column (scalar Crout algorithm).
+     * Kept as reference implementation; factorized() uses factorizeBlocked.
+     */
+    void factorizeScalar();
+    /**
+     * Factorizes the receiver to U(T).D.U form in panels of consecutive columns.
+     * The updates of panel columns by columns preceding the panel are mutually independent and
+     * are computed in parallel (OpenMP), the columns inside the panel are then finished in order.
+     * The inner products are evaluated by an unrolled kernel with independent partial sums,
+     * which vectorizes. Results differ from factorizeScalar only by round-off.
+     * @param panelSize Number of columns in one panel.
+     */
+    void factorizeBlocked(int panelSize = Skyline_FACTORIZATION_PANEL);
     FloatArray *backSubstitutionWith(FloatArray &) const override;
     void zero() override;
     /**
@@ -79,6 +79,7 @@ public:
     int setInternalStructure(IntArray &a);
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
     bool canBeFactorized() const override { return true; }
     SparseMtrx *factorized() override;
     FloatArray *backSubstitutionWith(FloatArray &) const override;
@@ -129,6 +129,8 @@ public:
 
     /// Return graph node
     SloanGraphNode &giveNode(int num);
+    /// Returns the number of graph nodes, i.e. the domain dof managers followed by the internal dof managers of elements and boundary conditions.
+    int giveNumberOfNodes() const { return (int)nodes.size(); }
 
     /// Finds the peripheral nodes (rooted in optimal start node) according to receiver quality and current weights.
     void findPeripheralNodes();
@@ -182,8 +184,17 @@ public:
      * MinimalProfileSize, OptimalWeightDegree and OptimalWeightDistance attributes.
      */
     void tryParameters(int wdeg, int wdis);
+    /**
+     * Generates the reverse Cuthill-McKee numbering (breadth-first search from pseudo-peripheral nodes,
+     * neighbours visited in order of increasing degree, resulting order reversed).
+     * Separated sub-domains and isolated nodes are numbered one after another.
+     * The result is kept if it is better than the optimal profile found so far.
+     */
+    void tryReverseCuthillMcKee();
 
 private:
+    /// Stores the current new numbering as optimal if the given profile size is the smallest found so far.
+    void updateOptimalNumbering(int psize, int wdeg, int wdis);
     /// Returns graph node number with minimal degree.
     int giveNodeWithMinDegree();
     /**
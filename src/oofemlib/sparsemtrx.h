@@ -43,6 +43,10 @@
 #include "sparsemtrxtype.h"
 
 #include <memory>
+#include <atomic>
+
+/// Minimal number of rows (columns) of sparse matrix, for which the matrix-vector products are evaluated in parallel (OpenMP).
+#define SparseMtrx_OMP_MINSIZE 2000
 
 namespace oofem {
 class EngngModel;
@@ -78,8 +82,9 @@ protected:
      * particular matrix; the preconditioner initialization can be demanding
      * and this versioning allows to reuse initialized preconditioner for same
      * matrix, if there is no change;
+     * The counter is atomic, as the matrices supporting concurrent assembly are modified from several threads.
      */
-    SparseMtrxVersionType version;
+    std :: atomic< SparseMtrxVersionType >version;
 
 public:
     /**
@@ -87,6 +92,13 @@ public:
      * not all coefficient are physically stored (in general, zero members are omitted).
      */
     SparseMtrx(int n=0, int m=0) : nRows(n), nColumns(m), version(0) { }
+    SparseMtrx(const SparseMtrx &s) : nRows(s.nRows), nColumns(s.nColumns), version( s.version.load() ) { }
+    SparseMtrx &operator = ( const SparseMtrx &s ) {
+        nRows = s.nRows;
+        nColumns = s.nColumns;
+        version = s.version.load();
+        return * this;
+    }
     /// Destructor
     virtual ~SparseMtrx() { }
 
@@ -236,6 +248,31 @@ public:
     virtual int assembleBegin() { return 1; }
     /// Returns when assemble is completed.
     virtual int assembleEnd() { return 1; }
+    /**
+     * Returns true if contributions with disjoint location arrays can be assembled concurrently
+     * (from several threads) without any locking, i.e. assembly only touches the storage of
+     * the given rows/columns. Used by lock-free colored assembly in EngngModel.
+     * The version counter is the only shared state such an assembly may modify.
+     */
+    virtual bool supportsConcurrentAssembly() const { return false; }
+    /**
+     * Enables caching of scatter maps (positions of contributions in the storage of the receiver),
+     * used by assembleWithScatterMap. The cached maps are discarded when the internal structure is rebuilt.
+     * Storage types that do not support scatter maps ignore this call.
+     * @param nkeys Number of keys (typically the number of elements).
+     */
+    virtual void enableScatterMaps(int nkeys) { }
+    /**
+     * Assembles contribution like assemble(loc, mat), but may reuse a scatter map cached for the given key.
+     * The cached map is reused as long as the key is assembled with the same location array; a different
+     * location array replaces the map of the key. The result is always the same as of assemble(loc, mat).
+     * For a pattern that doesn't change between assemblies, repeated assembly becomes a direct indexed add.
+     * @param key Key (1-based, typically element number) of the cached map.
+     * @param loc Location array.
+     * @param mat Contribution to be assembled.
+     * @return Zero iff successful.
+     */
+    virtual int assembleWithScatterMap(int key, const IntArray &loc, const FloatMatrix &mat) { return this->assemble(loc, mat); }
 
     /// Determines, whether receiver can be factorized.
     virtual bool canBeFactorized() const = 0;
@@ -0,0 +1,110 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef sparsitypatternbuilder_h
+#define sparsitypatternbuilder_h
+
+#include "oofemcfg.h"
+#include "intarray.h"
+
+#include <vector>
+
+namespace oofem {
+class EngngModel;
+class UnknownNumberingScheme;
+
+/**
+ * Builds the nonzero pattern of sparse matrices from the location arrays of elements and active boundary conditions.
+ * Shared by the compressed column/row storage types (and used for profile computation in skyline).
+ *
+ * Instead of inserting every coefficient into per-column ordered sets, the pattern is built in passes over
+ * flat arrays:
+ * - location arrays of all elements are collected (in parallel with OpenMP),
+ * - the location arrays are transposed into a column to contribution map (counting sort),
+ * - the rows of each column are gathered, sorted and made unique (in parallel over columns),
+ *   first to count the nonzeros, then to fill the row index of the compressed storage.
+ *
+ * Every contribution is a block with row and column location arrays; for elements both are the same array.
+ */
+class OOFEM_EXPORT SparsityPatternBuilder
+{
+protected:
+    /// Location arrays of all contributions.
+    std :: vector< IntArray >locs;
+    /// Index into locs of row location array of each block.
+    std :: vector< int >rowLocs;
+    /// Index into locs of column location array of each block.
+    std :: vector< int >colLocs;
+
+public:
+    SparsityPatternBuilder() { }
+
+    /**
+     * Collects location arrays from elements and active boundary conditions of the given domain.
+     * @param eModel Engineering model.
+     * @param di Domain index.
+     * @param s Numbering scheme (same for rows and columns).
+     */
+    void collect(EngngModel *eModel, int di, const UnknownNumberingScheme &s);
+
+    /// Returns number of collected blocks.
+    int giveNumberOfBlocks() const { return (int)rowLocs.size(); }
+    /// Returns row location array of block i (0-based).
+    const IntArray &giveRowLocation(int i) const { return locs [ rowLocs [ i ] ]; }
+    /// Returns column location array of block i (0-based).
+    const IntArray &giveColumnLocation(int i) const { return locs [ colLocs [ i ] ]; }
+
+    /**
+     * Builds 0-based compressed column pattern from collected blocks, with sorted row indices in each column.
+     * @param colptr Column pointers (size neq+1).
+     * @param rowind Row indices.
+     * @param neq Number of equations (columns).
+     * @param lowerOnly If true, only the lower triangle (including diagonal) is included.
+     */
+    void buildCompressedColumns(IntArray &colptr, IntArray &rowind, int neq, bool lowerOnly) const;
+
+protected:
+    /**
+     * Gathers sorted unique rows (0-based) of a column.
+     * @param rows Gathered rows.
+     * @param j Column (0-based).
+     * @param colBlockPtr Start of blocks of each column in colBlocks.
+     * @param colBlocks Blocks contributing to columns.
+     * @param lowerOnly Whether only rows below (and at) diagonal are gathered.
+     */
+    void gatherColumnRows(std :: vector< int > &rows, int j, const IntArray &colBlockPtr, const IntArray &colBlocks, bool lowerOnly) const;
+};
+} // end namespace oofem
+#endif // sparsitypatternbuilder_h
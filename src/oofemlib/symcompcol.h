@@ -100,6 +100,7 @@ public:
     int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &) override;
     int assemble(const IntArray &loc, const FloatMatrix &mat) override;
     int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) override;
+    bool supportsConcurrentAssembly() const override { return true; }
     bool canBeFactorized() const override { return false; }
     void zero() override;
     double &at(int i, int j) override;
@@ -109,6 +110,7 @@ public:
     bool isAsymmetric() const override { return false; }
 
 protected:
+    int giveValueIndex(int i, int j) const override;
 
     /***********************************/
     /*  General access function (slow) */
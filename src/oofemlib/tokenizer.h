@@ -50,8 +50,10 @@ namespace oofem {
 class OOFEM_EXPORT Tokenizer
 {
 private:
-    /// Array of tokens
-    std :: vector< std :: string >tokens;
+    /// Tokens stored one after another, each one terminated by '\0'
+    std :: string tokens;
+    /// Positions of the tokens in the token buffer
+    std :: vector< std :: size_t >offsets;
 
 public:
     /// Constructor. Creates tokenizer with given character as separator.
@@ -70,32 +72,32 @@ protected:
      * @param pos Starting position.
      * @param line Record from which token is parsed.
      */
-    std :: string readSimpleToken(std :: size_t &pos, const std :: string &line);
+    void readSimpleToken(std :: size_t &pos, const std :: string &line);
     /**
      * Reads next token (stops when separator is reached)
      * @param pos Starting position.
      * @param line Record from which token is parsed.
      * @param sep Separator.
      */
-    std :: string readToken(std :: size_t &pos, const std :: string &line, char sep);
+    void readToken(std :: size_t &pos, const std :: string &line, char sep);
     /**
      * Reads next structured token (bounded by '{' '}' pairs, possibly nested).
      * @param pos Starting position (should point to a '{').
      * @param line Record from which token is parsed.
      */
-    std :: string readStructToken(std :: size_t &pos, const std :: string &line);
+    void readStructToken(std :: size_t &pos, const std :: string &line);
     /**
      * Reads next string token (quoted).
      * @param pos Position (index) in token buffer.
      * @param line Record from which token is parsed.
      */
-    std :: string readStringToken(std :: size_t &pos, const std :: string &line);
+    void readStringToken(std :: size_t &pos, const std :: string &line);
     /**
      * Reads next simple expression token (section identified by starting with '$' and finishing with '$').
      * @param pos Position (index) in token buffer.
      * @param line Record from which token is parsed.
      */
-    std :: string readSimpleExpressionToken(std :: size_t &pos, const std :: string &line);
+    void readSimpleExpressionToken(std :: size_t &pos, const std :: string &line);
 };
 } // end namespace oofem
 #endif // tokenizer_h
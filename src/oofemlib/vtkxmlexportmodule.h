@@ -66,6 +66,9 @@ namespace py = pybind11;
 
 #include <string>
 #include <list>
+#ifdef __ASYNC_VTK
+ #include <thread>
+#endif
 
 ///@name Input fields for VTK XML export module
 //@{
@@ -77,8 +80,14 @@ namespace py = pybind11;
 #define _IFT_VTKXMLExportModule_ipvars "ipvars"
 #define _IFT_VTKXMLExportModule_stype "stype"
 #define _IFT_VTKXMLExportModule_particleexportflag "particleexportflag"
+#define _IFT_VTKXMLExportModule_dataformat "dataformat"
+#define _IFT_VTKXMLExportModule_compress "compress"
+#define _IFT_VTKXMLExportModule_asyncwrite "asyncwrite"
 //@}
 
+/// Block size (in bytes) used when compressing appended data arrays.
+#define VTKXMLExportModule_COMPRESSION_BLOCK 32768
+
 using namespace std;
 namespace oofem {
 class Node;
@@ -190,6 +199,30 @@ protected:
     /// Buffer for earlier time steps with gauss points exported to *.gp.pvd file.
     std::list< std::string >gpPvdBuffer;
 
+    /// Encoding of data arrays written without the VTK library.
+    enum VTKDataFormat { VTKFormat_ASCII = 0, VTKFormat_Base64 = 1, VTKFormat_Raw = 2 };
+    /// Value type of a data array.
+    enum VTKDataArrayType { VTKArray_Float64, VTKArray_Int32, VTKArray_UInt8 };
+
+    /// Selected encoding of data arrays (ascii inline, base64 or raw appended).
+    VTKDataFormat dataFormat;
+    /// Compress appended data arrays with zlib.
+    bool compressFlag;
+    /// Write the appended data section and close the file in a background thread.
+    bool asyncWriteFlag;
+#ifndef __VTK_MODULE
+    /// Type of the currently open data array.
+    VTKDataArrayType dataArrayType;
+    /// Raw little endian values of the currently open data array (appended formats only).
+    std::string dataArrayBuffer;
+    /// Encoded appended data section of the file being written.
+    std::string appendedData;
+#ifdef __ASYNC_VTK
+    /// Thread finishing the previously written file (asyncwrite only).
+    std::thread writerThread;
+#endif
+#endif
+
 #ifdef _PYBIND_BINDINGS
     ///Dictionaries used for Python export
     py::dict Py_PrimaryVars, Py_IntVars, Py_CellVars, Py_Nodes, Py_Elements;
@@ -365,6 +398,40 @@ protected:
 #endif
 
 
+#ifndef __VTK_MODULE
+    /**
+     * Writes the file comment, the VTKFile and UnstructuredGrid opening tags to fileStream.
+     * Waits for the background writer of the previous file, if any.
+     */
+    void writeVTKFileHeader(TimeStep *tStep);
+    /**
+     * Same as above, but writes to the given stream instead of the default output file
+     * of the step. The stream becomes the fileStream of the receiver.
+     */
+    void writeVTKFileHeader(std::ofstream stream, TimeStep *tStep);
+    /**
+     * Closes the UnstructuredGrid, writes the appended data section (if any) and closes the file.
+     * With asyncwrite enabled, the appended data are written in a background thread.
+     */
+    void writeVTKFileFooter();
+    /// Waits until the background writer thread (if any) has finished.
+    void finishAsyncWrite();
+    /**
+     * Starts a new data array. In ascii format the values are written inline, otherwise
+     * the array refers by offset to the appended data section.
+     * @param type Value type of the array.
+     * @param name Name of the array, omitted if empty.
+     * @param ncomponents Number of components (written for Float64 arrays only).
+     */
+    void beginDataArray(VTKDataArrayType type, const std::string &name, int ncomponents = 1);
+    /// Writes one value to the currently open data array.
+    void writeDataArrayValue(double value);
+    /// Writes one value to the currently open data array.
+    void writeDataArrayValue(int value);
+    /// Closes the currently open data array, encoding its values to the appended data section if necessary.
+    void endDataArray();
+#endif
+
 #ifdef __VTK_MODULE
     void writeVTKPointData(const char *name, vtkSmartPointer< vtkDoubleArray >varArray);
 #else
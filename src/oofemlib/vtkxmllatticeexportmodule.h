@@ -76,8 +76,6 @@ public:
     /// Destructor
     virtual ~VTKXMLLatticeExportModule();
 
-    std::ofstream fileStreamCross;
-
     VTKPiece defaultVTKPieceCross;
 
     void initializeFrom(InputRecord &ir) override;
@@ -0,0 +1,98 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef contactdefinitionnode2segment_h
+#define contactdefinitionnode2segment_h
+
+#include "contact/contactdefinition.h"
+#include "contact/sweepandprune.h"
+#include "intarray.h"
+
+#include <vector>
+#include <utility>
+
+///@name Input fields for _IFT_ContactDefinitionNode2Segment
+//@{
+#define _IFT_ContactDefinitionNode2Segment_Name "cdef_node2segp"
+#define _IFT_ContactDefinitionNode2Segment_SlaveNodes "slavenodes"
+#define _IFT_ContactDefinitionNode2Segment_MasterSegments "mastersegments"
+#define _IFT_ContactDefinitionNode2Segment_PenaltyN "penaltyn"
+#define _IFT_ContactDefinitionNode2Segment_SearchMargin "searchmargin"
+//@}
+
+namespace oofem {
+/**
+ * Node to segment contact in 2D with penalty enforcement.
+ * Slave nodes are not paired with master segments in the input; the pairs are searched for
+ * at the beginning of each step. Slave nodes and master segments are enclosed in bounding boxes
+ * (the boxes of slave nodes are inflated by the search margin) and the overlapping boxes are found
+ * by a sweep and prune broad phase. A contact element is created for each candidate pair, the contact
+ * condition itself is checked by the element. Small sliding is assumed within a step.
+ *
+ * Master segments are given by pairs of node numbers, the master boundary has to be oriented
+ * counterclockwise (the outer normal points to the right of the segment).
+ */
+class OOFEM_EXPORT ContactDefinitionNode2Segment : public ContactDefinition
+{
+private:
+    IntArray slaveNodes;
+    IntArray masterSegments;
+    double epsN;
+    /// Distance in which the contact pairs are searched for.
+    double searchMargin;
+
+    SweepAndPrune broadPhase;
+    /// Current pairs of slave node and master segment indices.
+    std :: vector< std :: pair< int, int > >pairs;
+
+public:
+    /// Constructor.
+    ContactDefinitionNode2Segment(ContactManager *cMan);
+    /// Destructor.
+    virtual ~ContactDefinitionNode2Segment() { }
+
+    void initializeFrom(InputRecord &ir) override;
+    bool updateContactPairs(TimeStep *tStep) override;
+    bool requiresContactPairUpdates() override { return true; }
+
+    const char *giveClassName() const override { return "ContactDefinitionNode2Segment"; }
+    virtual const char *giveInputRecordName() const { return _IFT_ContactDefinitionNode2Segment_Name; }
+
+protected:
+    /// Computes the current (deformed) coordinates of a node.
+    void giveCurrentCoordinates(FloatArray &answer, int node, TimeStep *tStep);
+};
+} // end namespace oofem
+#endif // contactdefinitionnode2segment_h
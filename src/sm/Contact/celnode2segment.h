@@ -0,0 +1,83 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef celnode2segment_h
+#define celnode2segment_h
+
+#include "contact/contactelement.h"
+
+namespace oofem {
+class DofManager;
+class TimeStep;
+
+/**
+ * Penalty contact between a slave node and a straight master segment in 2D.
+ * The gap is the distance of the slave node from the segment along the outer normal of the master
+ * boundary (negative for penetration). The contact is active if the gap is negative and the
+ * projection of the slave node lies on the segment.
+ */
+class OOFEM_EXPORT Node2SegmentContact : public ContactElement
+{
+private:
+    DofManager *slaveNode;
+    DofManager *masterNode1;
+    DofManager *masterNode2;
+    /// Penalty stiffness.
+    double epsN;
+
+public:
+    /// Constructor.
+    Node2SegmentContact(DofManager *slave, DofManager *master1, DofManager *master2, double epsN);
+    /// Destructor.
+    virtual ~Node2SegmentContact() { }
+
+    /**
+     * Computes the normal gap in the current configuration.
+     * @param xi Local coordinate of the projection of the slave node on the segment (0 and 1 at the end nodes).
+     * @param N Derivative of the gap with respect to the displacements of the slave and the master nodes.
+     * @param tStep Time step.
+     * @return Normal gap.
+     */
+    double computeGap(double &xi, FloatArray &N, TimeStep *tStep);
+
+    void computeContactForces(FloatArray &answer, TimeStep *tStep, ValueModeType mode,
+                              const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms) override;
+
+    void computeContactTangent(FloatMatrix &answer, TimeStep *tStep) override;
+
+    void giveLocationArray(IntArray &answer, const UnknownNumberingScheme &s) override;
+};
+} // end namespace oofem
+#endif // celnode2segment_h
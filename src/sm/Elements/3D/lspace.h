@@ -70,6 +70,7 @@ public:
     LSpace(int n, Domain *d);
     virtual ~LSpace() { }
     FEInterpolation *giveInterpolation() const override;
+    bool computeStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< StructuralElement * > &elems, TimeStep *tStep) override;
 
     Interface *giveInterface(InterfaceType it) override;
     int testElementExtension(ElementExtension ext) override
@@ -64,6 +64,7 @@ public:
     virtual ~QSpace() { }
 
     FEInterpolation *giveInterpolation() const override;
+    bool computeStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< StructuralElement * > &elems, TimeStep *tStep) override;
 
     void initializeFrom(InputRecord &ir) override;
 
@@ -69,6 +69,7 @@ public:
 
     Interface *giveInterface(InterfaceType it) override;
     FEInterpolation *giveInterpolation() const override;
+    bool computeStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< StructuralElement * > &elems, TimeStep *tStep) override;
 
     void SPRNodalRecoveryMI_giveSPRAssemblyPoints(IntArray &pap) override;
     void SPRNodalRecoveryMI_giveDofMansDeterminedByPatch(IntArray &answer, int pap) override;
@@ -97,6 +98,8 @@ public:
 
 protected:
     void computeBmatrixAt(double xi, double eta, FloatMatrix& answer);
+    /// Assembles the B matrix from shape function derivatives at the point, dnx is overwritten with derivatives at the centre for reduced shear integration.
+    void computeBmatrixFrom(FloatMatrix& dnx, FloatMatrix& answer);
     void computeBmatrixAt(GaussPoint* gp, FloatMatrix& answer, int = 1, int = ALL_STRAINS) override;
     void computeBHmatrixAt(GaussPoint* gp, FloatMatrix& answer) override;
 
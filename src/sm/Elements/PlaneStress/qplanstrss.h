@@ -59,6 +59,7 @@ public:
     virtual ~QPlaneStress2d() { }
 
     FEInterpolation *giveInterpolation() const override;
+    bool computeStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< StructuralElement * > &elems, TimeStep *tStep) override;
 
     // definition & identification
     const char *giveInputRecordName() const override { return _IFT_QPlaneStress2d_Name; }
@@ -143,6 +143,7 @@ public:
      */
     void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep) override;
 
+    bool hasConstantStiffness() override { return nlGeometry == 0 && StructuralElement :: hasConstantStiffness(); }
 
     /**
      * Computes the initial stiffness matrix of receiver. This method is used only if mode = UL
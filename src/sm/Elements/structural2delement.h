@@ -86,6 +86,8 @@ public:
     void initializeFrom(InputRecord &ir) override;
 
     double giveCharacteristicLength(const FloatArray &normalToCrackPlane) override;
+    /// Returns true if the material directions are given by the element orientation (see _IFT_Structural2DElement_materialCoordinateSystem).
+    bool hasMaterialCoordinateSystem() const { return matRotation; }
 
 protected:
     void computeBmatrixAt(GaussPoint *gp, FloatMatrix &answer, int lowerIndx = 1, int upperIndx = ALL_STRAINS) override = 0;
@@ -77,6 +77,8 @@ public:
     double giveCharacteristicLength(const FloatArray &normalToCrackPlane) override;
 
     void giveMaterialOrientationAt(FloatArray &x, FloatArray &y, FloatArray &z, const FloatArray &lcoords);
+    /// Returns true if the material directions are given by the element orientation (see _IFT_Structural3DElement_materialCoordinateSystem).
+    bool hasMaterialCoordinateSystem() const { return matRotation; }
     void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep) override;
     void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp, TimeStep *tStep) override;
     void computeInitialStressMatrix(FloatMatrix &answer, TimeStep *tStep) override;
@@ -109,6 +109,7 @@ public:
     virtual ~StructuralElement();
 
     void giveCharacteristicMatrix(FloatMatrix & answer, CharType, TimeStep * tStep) override;
+    bool giveCharacteristicMatrixBatch(std :: vector< FloatMatrix > &answer, CharType type, const IntArray &elems, TimeStep *tStep) override;
     void giveCharacteristicVector(FloatArray &answer, CharType type, ValueModeType mode, TimeStep *tStep) override;
 
     /**
@@ -181,10 +182,27 @@ public:
      * @param tStep Time step.
      */
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
+    /**
+     * Computes the stiffness matrices of a batch of elements at once.
+     * The elements are of the same type as the receiver, which is one of them.
+     * Default implementation returns false, the elements are then evaluated by computeStiffnessMatrix one by one.
+     * Elements with a fixed-size interpolation can provide vectorized evaluation, see StructuralElementBatch.
+     * @param answer Computed stiffness matrices, one for each element in elems.
+     * @param rMode Response mode.
+     * @param elems Elements in batch.
+     * @param tStep Time step.
+     * @return True if all stiffness matrices have been computed.
+     */
+    virtual bool computeStiffnessMatrixBatch(std :: vector< FloatMatrix > &answer, MatResponseMode rMode, const std :: vector< StructuralElement * > &elems, TimeStep *tStep) { return false; }
     /**
      * @see giveStiffnessMatrix
      */
     void computeStiffnessMatrix_withIRulesAsSubcells(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
+    /**
+     * Returns true if the receiver has no activity time function and the materials of all
+     * integration points have constant stiffness (see Material::hasConstantStiffness).
+     */
+    bool hasConstantStiffness() override;
 
     /**
      * Computes initial stress matrix for linear stability problem.
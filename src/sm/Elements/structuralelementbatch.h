@@ -0,0 +1,86 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef structuralelementbatch_h
+#define structuralelementbatch_h
+
+#include "floatmatrix.h"
+#include "matresponsemode.h"
+
+#include <vector>
+
+namespace oofem {
+class StructuralElement;
+class TimeStep;
+
+/**
+ * Evaluates the small strain stiffness matrices of a batch of elements of the same type at once.
+ * Instead of computing B and D one element and one Gauss point at a time, the geometry, the strain-displacement
+ * matrices and the stiffness contributions of all elements in the batch are stored in structure-of-arrays layout
+ * (element index running fastest), so that the innermost loops run over the elements and can be vectorized.
+ * The shape function derivatives in the parent domain are shared by all elements and are evaluated only once
+ * per integration point through the static fixed-size services of the interpolation.
+ *
+ * The kernel covers isoparametric continuum elements with one displacement dof per spatial direction in each node
+ * (plane stress and 3D solids). The calling element is responsible for checking that its B-matrix has the
+ * standard form (no material rotation, etc.), the kernel checks the remaining requirements itself and
+ * returns false if the batch can not be evaluated, in which case the elements are to be evaluated one by one.
+ *
+ * @tparam FEI Interpolation class providing static evaldNdxi.
+ * @tparam NSD Number of spatial dimensions (2 for plane stress, 3 for solids).
+ * @tparam NNODES Number of nodes of the interpolation.
+ */
+template< class FEI, int NSD, int NNODES >
+class StructuralElementBatch
+{
+public:
+    /// Number of element dofs.
+    static constexpr int NDOFS = NSD * NNODES;
+    /// Number of strain components.
+    static constexpr int NSTRAINS = NSD == 3 ? 6 : 3;
+
+    /**
+     * Computes the stiffness matrices of given elements.
+     * @param answer Stiffness matrices, one for each element in elems.
+     * @param elems Elements, all of the same type.
+     * @param rMode Material response mode.
+     * @param reducedShear If true, the shear strains are evaluated from shape function derivatives in the element centre.
+     * @param tStep Time step.
+     * @return True if the batch has been evaluated.
+     */
+    static bool computeStiffnessMatrices(std :: vector< FloatMatrix > &answer, const std :: vector< StructuralElement * > &elems,
+                                         MatResponseMode rMode, bool reducedShear, TimeStep *tStep);
+};
+} // end namespace oofem
+#endif // structuralelementbatch_h
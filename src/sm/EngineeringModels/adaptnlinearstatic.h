@@ -104,6 +104,7 @@ public:
 
     void initializeFrom(InputRecord &ir) override;
     double giveUnknownComponent(ValueModeType mode, TimeStep *tStep, Domain *d, Dof *dof) override;
+    const FloatArray *giveDirectUnknownVector(ValueModeType mode, TimeStep *tStep, Domain *d) override;
 
     /**
      * Returns the load level corresponding to given solution step number.
@@ -62,11 +62,16 @@ namespace oofem {
  * Supports the changes of static scheme (applying, removing and changing  boundary conditions)
  * during the analysis.
  *
+ * The stiffness matrix (and its factorization) is kept between solution steps if all elements report
+ * constant stiffness (Element::hasConstantStiffness) and neither the equation numbering nor the element
+ * activity has changed; only the load vector is then assembled and the system is solved by back substitution.
  */
 class IncrementalLinearStatic : public StructuralEngngModel
 {
 protected:
     std :: unique_ptr< SparseMtrx > stiffnessMatrix;
+    /// Element activity and location arrays, for which the stiffness matrix was assembled.
+    std :: vector< int > stiffnessMatrixState;
     FloatArray loadVector;
     FloatArray internalLoadVector;
     FloatArray incrementOfDisplacementVector;
@@ -121,6 +126,15 @@ public:
     void updateDofUnknownsDictionary(DofManager *dman, TimeStep *tStep) override;
     // Here we store only total and incremental value; so hash is computed from mode value only
     int giveUnknownDictHashIndx(ValueModeType mode, TimeStep *tStep) override;
+
+protected:
+    /**
+     * Checks whether the stiffness matrix has to be assembled in given solution step.
+     * The current element activity and location arrays are remembered for the next check.
+     * @param tStep Solution step.
+     * @return True if the stiffness matrix is not available or may have changed.
+     */
+    bool requiresStiffnessMatrixUpdate(TimeStep *tStep);
 };
 } // end namespace oofem
 #endif // incrementallinearstatic_h
@@ -83,6 +83,7 @@ public:
     void solveYourselfAt(TimeStep *tStep) override;
 
     double giveUnknownComponent(ValueModeType type, TimeStep *tStep, Domain *d, Dof *dof) override;
+    const FloatArray *giveDirectUnknownVector(ValueModeType mode, TimeStep *tStep, Domain *d) override;
     void saveContext(DataStream &stream, ContextMode mode) override;
     void restoreContext(DataStream &stream, ContextMode mode) override;
 
@@ -38,6 +38,7 @@
 #include "sm/EngineeringModels/structengngmodel.h"
 #include "floatarray.h"
 #include "floatmatrix.h"
+#include "intarray.h"
 #include "sparselinsystemnm.h"
 #include "sparsemtrxtype.h"
 
@@ -55,6 +56,8 @@
 #define _IFT_NlDEIDynamic_py "py"
 #define _IFT_NlDEIDynamic_nonlocalext "nonlocalext"
 #define _IFT_NlDEIDynamic_reduct "reduct"
+#define _IFT_NlDEIDynamic_subcycle "subcycle"
+#define _IFT_NlDEIDynamic_massscaling "massscaling"
 //@}
 
 namespace oofem {
@@ -87,6 +90,12 @@ namespace oofem {
  * - Additional mode has been introduced remote element mode. It introduces the "remote" elements, the
  *   exact local mirrors of remote counterparts. Introduced to support general nonlocal constitutive models,
  *   in order to provide efficient way, how to average local data without need of fine grain communication.
+ *
+ * Optionally, the equations can be integrated with different time steps (subcycling). The stable time step of each
+ * element is estimated from its lumped mass and stiffness and elements are sorted into classes integrated with
+ * time steps deltaT/2^k. Each equation is updated with the step of the finest element class it is connected to,
+ * displacements of the equations not updated in a substep are linearly interpolated. Elements with stable
+ * time steps below a given target can be also selectively mass scaled, the added mass is reported.
  */
 class NlDEIDynamic : public StructuralEngngModel
 {
@@ -109,6 +118,16 @@ protected:
     int initFlag;
     /// Optional reduction factor for time step deltaT
     double reductionFactor;
+    /// Maximal number of subcycling levels, the element classes are integrated with steps deltaT/2^k, k <= subcycleLevels.
+    int subcycleLevels;
+    /// Number of substeps of the finest element class in one time step.
+    int numberOfSubsteps;
+    /// Update period of equations and elements, in number of substeps.
+    IntArray equationStride, elementStride;
+    /// Element estimates of the maximal eigenfrequency (squared).
+    FloatArray elementMaxOm;
+    /// Target time step for the selective mass scaling (zero if not used).
+    double massScalingDt;
     // dynamic relaxation specific vars
     /// Flag indicating whether dynamic relaxation takes place.
     int drFlag;
@@ -178,6 +197,24 @@ protected:
      */
     void computeMassMtrx(FloatArray &mass, double &maxOm, TimeStep *tStep);
     void computeMassMtrx2(FloatMatrix &mass, double &maxOm, TimeStep *tStep);
+    /**
+     * Sorts the elements and equations into the subcycling classes according to the element estimates
+     * of eigenfrequency, computed by computeMassMtrx.
+     */
+    void assignSubcycleClasses();
+    /**
+     * Advances the solution over one time step by substeps of the finest class.
+     * Equations are updated with the period of their class, the external loads are kept constant over the time step.
+     * @param tStep Time step.
+     */
+    void solveSubcycles(TimeStep *tStep);
+    /**
+     * Assembles the internal forces of the elements active in given substep.
+     * @param answer Internal forces, valid only in equations updated in the substep.
+     * @param substep Substep number.
+     * @param tStep Time step.
+     */
+    void computeSubcycleInternalForces(FloatArray &answer, int substep, TimeStep *tStep);
 
 public:
     int estimateMaxPackSize(IntArray &commMap, DataStream &buff, int packUnpackType) override;
@@ -155,6 +155,7 @@ public:
     void updateAttributes(MetaStep *mStep) override;
 
     double giveUnknownComponent(ValueModeType type, TimeStep *tStep, Domain *d, Dof *dof) override;
+    const FloatArray *giveDirectUnknownVector(ValueModeType mode, TimeStep *tStep, Domain *d) override;
     void initializeFrom(InputRecord &ir) override;
     TimeStep *giveSolutionStepWhenIcApply(bool force = false) override;
     TimeStep *giveNextStep() override;
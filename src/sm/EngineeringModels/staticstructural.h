@@ -65,7 +65,7 @@ protected:
     FloatArray eNorm;
 
 public:
-    std :: unique_ptr< SparseMtrx >stiffnessMatrix;
+    std :: shared_ptr< SparseMtrx >stiffnessMatrix;
 protected:
 
     std :: unique_ptr< DofDistributedPrimaryField >field;
@@ -98,11 +98,21 @@ public:
     void updateComponent(TimeStep *tStep, NumericalCmpn cmpn, Domain *d) override;
     void updateSolution(FloatArray &solutionVector, TimeStep *tStep, Domain *d) override;
     void updateInternalRHS(FloatArray &answer, TimeStep *tStep, Domain *d, FloatArray *eNorm) override;
+    bool updatesContactPairs() override { return true; }
     void updateMatrix(SparseMtrx &mat, TimeStep *tStep, Domain *d) override;
 
     double giveUnknownComponent(ValueModeType type, TimeStep *tStep, Domain *d, Dof *dof) override;
     bool newDofHandling() override { return true; }
 
+    /// Returns the stiffness matrix, which is created (with the structure for the current equation numbering) if needed.
+    std :: shared_ptr< SparseMtrx > giveStiffnessMatrix();
+    /**
+     * Sets the stiffness matrix of the receiver. The matrix is reassembled in every solution step,
+     * so it can be shared by problems with the same equation numbering, which are solved one after another.
+     * @param mat Matrix with the structure for the current equation numbering, or nullptr.
+     */
+    void setStiffnessMatrix(std :: shared_ptr< SparseMtrx > mat) { this->stiffnessMatrix = std :: move(mat); }
+
     void updateDomainLinks() override;
 
     int forceEquationNumbering() override;
@@ -726,6 +726,7 @@ public:
     void initializeFrom(InputRecord &ir) override;
 
     const char *giveClassName() const override { return "ConcreteDPM2"; }
+    bool isReentrant() const override { return true; }
     const char *giveInputRecordName() const override { return _IFT_ConcreteDPM2_Name; }
 
     //void giveRealStressVector_1d(FloatArray &answer, GaussPoint *gp, const FloatArray &totalStrain, TimeStep *tStep) override;
@@ -248,6 +248,7 @@ public:
     virtual ~IsotropicDamageMaterial1();
 
     const char *giveClassName() const override { return "IsotropicDamageMaterial1"; }
+    bool isReentrant() const override { return true; }
     const char *giveInputRecordName() const override { return _IFT_IsotropicDamageMaterial1_Name; }
     void initializeFrom(InputRecord &ir) override;
     void giveInputRecord(DynamicInputRecord &input) override;
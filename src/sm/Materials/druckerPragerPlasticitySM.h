@@ -233,6 +233,7 @@ public:
     void initializeFrom(InputRecord &ir) override;
 
     const char *giveClassName() const override { return "DruckerPragerPlasticitySM"; }
+    bool isReentrant() const override { return true; }
     const char *giveInputRecordName() const override { return _IFT_DruckerPragerPlasticitySM_Name; }
 
     FloatArrayF<6> giveRealStressVector_3d(const FloatArrayF<6> &strain, GaussPoint *gp,
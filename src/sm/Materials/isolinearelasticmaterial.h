@@ -102,6 +102,7 @@ public:
     IsotropicLinearElasticMaterial(int n, Domain *d, double E, double nu);
 
     const char *giveClassName() const override { return "IsotropicLinearElasticMaterial"; }
+    bool isReentrant() const override { return true; }
     const char *giveInputRecordName() const override { return _IFT_IsotropicLinearElasticMaterial_Name; }
 
     /**
@@ -113,6 +113,8 @@ public:
     ///@todo This makes no sense in this  base class, it should belong to isotropiclinearelastic material.
     virtual double giveShearModulus() const { return 1.; }
     bool hasCastingTimeSupport() const override { return true; }
+    /// The stiffness is reduced before casting time, otherwise it is constant.
+    bool hasConstantStiffness() const override { return this->castingTime < 0.; }
     const char *giveClassName() const override { return "LinearElasticMaterial"; }
 };
 } // end namespace oofem
@@ -121,11 +121,14 @@ public:
     virtual double computeCumPlastStrain(GaussPoint *gp, TimeStep *tStep) const;
 
     void initializeFrom(InputRecord &ir) override;
+    void saveContext(DataStream &stream, ContextMode mode) override;
+    void restoreContext(DataStream &stream, ContextMode mode) override;
 
     bool isCharacteristicMtrxSymmetric(MatResponseMode rMode) const override { return false; }
 
     const char *giveInputRecordName() const override { return _IFT_MisesMat_Name; }
     const char *giveClassName() const override { return "MisesMat"; }
+    bool isReentrant() const override { return true; }
 
     MaterialStatus *CreateStatus(GaussPoint *gp) const override;
 
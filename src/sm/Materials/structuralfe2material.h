@@ -39,17 +39,52 @@
 #include "sm/Materials/structuralms.h"
 
 #include <memory>
+#include <vector>
 
 ///@name Input fields for StructuralFE2Material
 //@{
 #define _IFT_StructuralFE2Material_Name "structfe2material"
 #define _IFT_StructuralFE2Material_fileName "filename"
 #define _IFT_StructuralFE2Material_useNumericalTangent "use_num_tangent"
+#define _IFT_StructuralFE2Material_sharedRVE "shared_rve"
 //@}
 
 namespace oofem {
 class EngngModel;
 class PrescribedGradientHomogenization;
+class OOFEMTXTDataReader;
+class SparseMtrx;
+class StaticStructural;
+
+/**
+ * Data shared by all RVEs created from the same input file.
+ * The input file is parsed only once. The RVEs solved by one thread share a single stiffness matrix,
+ * which is reassembled in every solution of an RVE, so only the state of the RVE (mesh, solution and
+ * material statuses) is kept for every integration point.
+ */
+class StructuralFE2Template
+{
+protected:
+    /// Parsed input of the RVE.
+    std :: unique_ptr< OOFEMTXTDataReader > reader;
+    /// Stiffness matrices shared by RVEs, one for every thread.
+    std :: vector< std :: shared_ptr< SparseMtrx > > matrices;
+
+public:
+    StructuralFE2Template(const std :: string &inputfile);
+    ~StructuralFE2Template();
+
+    /// Returns the template of given input file, which is created if it does not exist yet.
+    static std :: shared_ptr< StructuralFE2Template > giveTemplate(const std :: string &inputfile);
+
+    /// Returns a copy of the parsed input of the RVE.
+    std :: unique_ptr< OOFEMTXTDataReader > giveDataReader() const;
+    /**
+     * Lets the RVE use the stiffness matrix of the calling thread.
+     * The matrix is created by the first RVE solved by the thread.
+     */
+    void attachStiffnessMatrix(StaticStructural &rve);
+};
 
 class StructuralFE2MaterialStatus : public StructuralMaterialStatus
 {
@@ -67,8 +102,12 @@ protected:
 
     std :: string mInputFile;
 
+    /// Shared data of RVEs created from the same input file (if used).
+    std :: shared_ptr< StructuralFE2Template > rveTemplate;
+
 public:
-    StructuralFE2MaterialStatus(int rank, GaussPoint * g,  const std :: string & inputfile);
+    StructuralFE2MaterialStatus(int rank, GaussPoint * g,  const std :: string & inputfile,
+                                std :: shared_ptr< StructuralFE2Template > rveTemplate = nullptr);
 
     EngngModel *giveRVE() const { return this->rve.get(); }
     PrescribedGradientHomogenization *giveBC();// { return this->bc; }
@@ -81,6 +120,8 @@ public:
 
     /// Copies time step data to RVE.
     void setTimeStep(TimeStep *tStep);
+    /// Solves the RVE problem (using the shared stiffness matrix if possible).
+    void solveRVE(TimeStep *tStep);
 
     FloatMatrix &giveTangent() { return tangent; }
 
@@ -123,6 +164,8 @@ protected:
     std :: string inputfile;
     static int n;
     bool useNumTangent = false;
+    /// Flag determining if RVEs share the parsed input and stiffness matrices, which also allows parallel evaluation.
+    bool sharedRVE = false;
 
 public:
     StructuralFE2Material(int n, Domain * d);
@@ -132,6 +175,8 @@ public:
     const char *giveInputRecordName() const override { return _IFT_StructuralFE2Material_Name; }
     const char *giveClassName() const override { return "StructuralFE2Material"; }
     bool isCharacteristicMtrxSymmetric(MatResponseMode rMode) const override { return true; }
+    /// Every integration point has its own RVE, the shared stiffness matrices are private to threads.
+    bool isReentrant() const override { return sharedRVE; }
 
     MaterialStatus *CreateStatus(GaussPoint *gp) const override;
     FloatArrayF<6> giveRealStressVector_3d(const FloatArrayF<6> &strain, GaussPoint *gp, TimeStep *tStep) const override;
@@ -0,0 +1,14 @@
+#
+# this test checks conversion of a text input file into the binary input format
+# and solving the problem from the binary file
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f binaryinput01.in.0 -cb binaryinput01.bin"
+# convert the text input file into binary form
+$OOFEM -f binaryinput01.in.0 -cb binaryinput01.bin || exit 1
+echo "Command: $OOFEM -f binaryinput01.bin"
+# solve the problem from the binary file, checks are read from binaryinput01.in.0
+$OOFEM -f binaryinput01.bin
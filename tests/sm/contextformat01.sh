@@ -0,0 +1,54 @@
+#
+# this test checks saving and restoring the chunked context files (contextformat 1 and 2):
+# the problem is solved with context files saved in each step and restarted from the second
+# step, the restarted step is checked against the results of a run without restart
+# the bar has more dof managers and elements than fit into a single section of the file
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+for format in 1 2; do
+    name=contextformat01.f$format
+    awk -v format=$format -v out=$name.out 'BEGIN {
+        n = 4200
+        print out
+        print "Test of restarting from chunked context files (plastic bar under dead weight, unloaded in the last step)"
+        print "StaticStructural nsteps 3 rtolv 1.e-6 maxiter 200 nmodules 1 contextformat " format
+        print "errorcheck"
+        print "domain 1dtruss"
+        print "OutputManager"
+        printf "ndofman %d nelem %d ncrosssect 1 nmat 1 nbc 2 nic 0 nltf 1 nset 2\n", n + 1, n
+        for ( i = 0; i <= n; i++ ) {
+            printf "node %d coords 3 %.10g 0. 0.\n", i + 1, i / n
+        }
+        for ( i = 1; i <= n; i++ ) {
+            printf "truss1d %d nodes 2 %d %d\n", i, i, i + 1
+        }
+        print "SimpleCS 1 area 1. material 1 set 1"
+        print "MisesMat 1 d 1. E 100. n 0.2 sig0 1. H 10. omega_crit 0. a 0. tAlpha 0."
+        print "BoundaryCondition 1 loadTimeFunction 1 dofs 1 1 values 1 0. set 2"
+        print "DeadWeight 2 loadTimeFunction 1 Components 1 0.8 set 1"
+        print "PiecewiseLinFunction 1 t 3 1. 2. 3. f(t) 3 1. 2. 0."
+        printf "Set 1 elementranges {(1 %d)}\n", n
+        print "Set 2 nodes 1 1"
+        print "#%BEGIN_CHECK% tolerance 1.e-6"
+        print "#NODE tStep 3 number 1000 dof 1 unknown d value 9.74522e-03"
+        print "#NODE tStep 3 number 4201 dof 1 unknown d value 1.12499e-02"
+        print "#ELEMENT tStep 3 number 1 gp 1 keyword 4 component 1 value 5.99802e-02"
+        print "#ELEMENT tStep 3 number 1000 gp 1 keyword 4 component 1 value 2.19235e-02"
+        print "#ELEMENT tStep 3 number 2000 gp 1 keyword 4 component 1 value 0.0"
+        print "#%END_CHECK%"
+    }' > $name.in.0
+
+    echo "Command: $OOFEM -f $name.in.0 -c"
+    # run target on input and store context files
+    $OOFEM -f $name.in.0 -c || exit 1
+    if [ "`head -c 8 $name.out.2.0.osf`" != "OOFEMCTX" ]; then
+        echo "Check failed: $name.out.2.0.osf is not a chunked context file"
+        exit 1
+    fi
+    echo "Command: $OOFEM -f $name.in.0 -r 2"
+    # restart from the second step, the checks of the last step fail if the state is not restored
+    $OOFEM -f $name.in.0 -r 2 || exit 1
+done
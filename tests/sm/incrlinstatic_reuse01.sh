@@ -0,0 +1,67 @@
+#
+# this test checks the reuse of the stiffness matrix in IncrLinearStatic: two trusses in series
+# are loaded by an increasing force. If the second material is cast during the analysis
+# (castingtime), the stiffness matrix has to be assembled in every step and the displacements
+# after casting are checked. If both materials have constant stiffness, the matrix of the first
+# step has to be reused in all the following steps.
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+# $1 name, $2 extra parameters of the second material, $3 check rules
+writeinput() {
+    cat > $1.in.0 <<EOF
+$1.out
+Reuse of the stiffness matrix in incremental linear static analysis
+IncrLinearStatic endOfTimeOfInterest 4. prescribedTimes 4 1. 2. 3. 4. nmodules 1
+errorcheck
+domain 1dtruss
+OutputManager tstep_all dofman_all element_all
+ndofman 3 nelem 2 ncrosssect 2 nmat 2 nbc 2 nic 0 nltf 1 nset 2
+node 1 coords 3 0. 0. 0.
+node 2 coords 3 1. 0. 0.
+node 3 coords 3 2. 0. 0.
+truss1d 1 nodes 2 1 2 crossSect 1 mat 1
+truss1d 2 nodes 2 2 3 crossSect 2 mat 2
+SimpleCS 1 area 1.
+SimpleCS 2 area 1.
+IsoLE 1 d 0. E 100. n 0.2 tAlpha 0.
+IsoLE 2 d 0. E 100. n 0.2 tAlpha 0. $2
+BoundaryCondition 1 loadTimeFunction 1 dofs 1 1 values 1 0. set 1
+NodalLoad 2 loadTimeFunction 1 dofs 1 1 Components 1 1. set 2
+PiecewiseLinFunction 1 t 2 0. 4. f(t) 2 0. 4.
+Set 1 nodes 1 1
+Set 2 nodes 1 3
+#%BEGIN_CHECK% tolerance 1.e-10
+$3
+#%END_CHECK%
+EOF
+}
+
+# $1 name, $2 expected number of assemblies, $3 expected number of reuses
+checkassembly() {
+    echo "Command: $OOFEM -f $1.in.0"
+    $OOFEM -f $1.in.0 > $1.log 2>&1 || { cat $1.log; exit 1; }
+    cat $1.log
+    nassembled=`grep -c "Assembling stiffness matrix" $1.log`
+    nreused=`grep -c "Reusing stiffness matrix" $1.log`
+    if [ "$nassembled" != "$2" ] || [ "$nreused" != "$3" ]; then
+        echo "Check failed: $1, stiffness matrix assembled $nassembled times and reused $nreused times instead of $2 and $3"
+        exit 1
+    fi
+}
+
+# the second truss has half of its stiffness before casting at time 2.5
+writeinput incrlinstatic_reuse01.cast "castingtime 2.5 precaststiffred 0.5" \
+"#NODE tStep 2 number 3 dof 1 unknown d value 6.0e-02
+#NODE tStep 3 number 3 dof 1 unknown d value 8.0e-02
+#NODE tStep 4 number 3 dof 1 unknown d value 1.0e-01
+#ELEMENT tStep 4 number 2 gp 1 keyword 1 component 1 value 4.0"
+checkassembly incrlinstatic_reuse01.cast 4 0
+
+writeinput incrlinstatic_reuse01.const "" \
+"#NODE tStep 2 number 3 dof 1 unknown d value 4.0e-02
+#NODE tStep 4 number 3 dof 1 unknown d value 8.0e-02
+#ELEMENT tStep 4 number 2 gp 1 keyword 1 component 1 value 4.0"
+checkassembly incrlinstatic_reuse01.const 1 3
@@ -0,0 +1,41 @@
+#
+# this test checks the values mapped to points of interest by the least square projection
+# (MMALeastSquareProjection, used by the poi export module with mtype 2)
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f mmaleastsquare01.in.0"
+$OOFEM -f mmaleastsquare01.in.0 || exit 1
+
+# expected stresses (1) and strains (4) in the last step: variable, poi, components
+cat > mmaleastsquare01.exp <<EOF
+1   1 -3.884652e-01 -1.288212e-01 0.000000e+00 0.000000e+00 0.000000e+00 -5.673481e-03
+1  27  1.713336e-01  4.377601e-02 0.000000e+00 0.000000e+00 0.000000e+00 -2.005865e-02
+1  53 -2.871097e-02 -5.306105e-03 0.000000e+00 0.000000e+00 0.000000e+00 -2.237351e-02
+1  84  1.565763e-01  5.730869e-03 0.000000e+00 0.000000e+00 0.000000e+00 -1.720703e-02
+1 116 -1.164255e-02 -8.644928e-04 0.000000e+00 0.000000e+00 0.000000e+00 -1.901960e-02
+1 145  9.504352e-03 -2.797419e-05 0.000000e+00 0.000000e+00 0.000000e+00 -1.800000e-02
+4   1 -4.441560e-03  3.696769e-04 0.000000e+00 0.000000e+00 0.000000e+00 -3.698971e-04
+4  27  1.731211e-03 -2.083649e-04 0.000000e+00 0.000000e+00 0.000000e+00 -3.357491e-04
+4  53 -2.435383e-04  3.880997e-05 0.000000e+00 0.000000e+00 0.000000e+00 -2.855004e-04
+4  84  9.234263e-04 -2.710842e-04 0.000000e+00 0.000000e+00 0.000000e+00 -2.475992e-04
+4 116 -6.111873e-05  1.474616e-05 0.000000e+00 0.000000e+00 0.000000e+00 -2.336192e-04
+4 145  4.756372e-05 -1.439640e-05 0.000000e+00 0.000000e+00 0.000000e+00 -2.340000e-04
+EOF
+
+echo "Comparing mapped values in mmaleastsquare01.out.m0.3.poi"
+awk '/POI_INTVAR_DATA/ { v = $2; next } NF == 7 { print v, $0 }' mmaleastsquare01.out.m0.3.poi > mmaleastsquare01.got
+awk 'function abs(x) { return x < 0 ? -x : x }
+     NR == FNR { for ( i = 3; i <= 8; i++ ) ref[$1 " " $2, i] = $i; n++; next }
+     {
+         m++
+         for ( i = 3; i <= 8; i++ ) {
+             if ( !( ( $1 " " $2, i ) in ref ) || abs($i - ref[$1 " " $2, i]) > 1.e-8 + 1.e-5 * abs(ref[$1 " " $2, i]) ) {
+                 print "Check failed: variable " $1 ", poi " $2 ", component " i - 2 ", value is " $i
+                 err = 1
+             }
+         }
+     }
+     END { if ( m != n ) { print "Check failed: " m " values mapped, " n " expected"; err = 1 } exit err }' mmaleastsquare01.exp mmaleastsquare01.got
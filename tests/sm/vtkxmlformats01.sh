@@ -0,0 +1,103 @@
+#
+# this test checks the binary encodings of the vtkxml export (dataformat 1 and 2, optionally
+# compressed): the problem is exported in ascii and in each binary format, the appended data
+# of the binary files (including the integration point files) are decoded and compared with
+# the ascii files array by array
+#
+OOFEM=$1
+echo "target executable: $OOFEM"
+pwd
+
+echo "Command: $OOFEM -f vtkxmlformats01.in.0"
+$OOFEM -f vtkxmlformats01.in.0 || exit 1
+
+formats="base64:dataformat_1 raw:dataformat_2 base64z:dataformat_1_compress rawz:dataformat_2_compress"
+for f in $formats; do
+    name=${f%%:*}
+    format=`echo ${f#*:} | tr _ ' '`
+    sed -e "1s/.*/vtkxmlformats01.$name.out/" -e "s/dataformat 0/$format/" vtkxmlformats01.in.0 > vtkxmlformats01.$name.in.0
+    echo "Command: $OOFEM -f vtkxmlformats01.$name.in.0"
+    $OOFEM -f vtkxmlformats01.$name.in.0 || exit 1
+done
+
+python3 - $formats <<'EOF'
+import base64, struct, sys, zlib
+import xml.etree.ElementTree as ET
+
+files = ['m0.1.vtu', 'm0.2.vtu', 'm0.1.cross.vtu', 'm0.2.cross.vtu', 'm1.1.vtu', 'm1.2.vtu', 'm1.1.gp.vtu', 'm1.2.gp.vtu']
+sizes = {'Float64': ('d', 8), 'Int32': ('i', 4), 'UInt8': ('B', 1)}
+
+
+def b64(data, start, nbytes):
+    return base64.b64decode(data[start:start + 4 * ((nbytes + 2) // 3)])[:nbytes]
+
+
+def decode(array, root, data, raw):
+    offset = int(array.get('offset'))
+    if root.get('compressor'):
+        nblocks = struct.unpack('<Q', data[offset:offset + 8] if raw else b64(data, offset, 8))[0]
+        hlen = 8 * (3 + nblocks)
+        header = data[offset:offset + hlen] if raw else b64(data, offset, hlen)
+        clens = struct.unpack('<%dQ' % nblocks, header[24:])
+        if raw:
+            payload = data[offset + hlen:offset + hlen + sum(clens)]
+        else:
+            payload = b64(data, offset + 4 * ((hlen + 2) // 3), sum(clens))
+        values, pos = b'', 0
+        for clen in clens:
+            values += zlib.decompress(payload[pos:pos + clen])
+            pos += clen
+    else:
+        nbytes = struct.unpack('<Q', data[offset:offset + 8] if raw else b64(data, offset, 8))[0]
+        values = data[offset + 8:offset + 8 + nbytes] if raw else b64(data, offset, 8 + nbytes)[8:]
+    code, size = sizes[array.get('type')]
+    if len(values) % size:
+        raise ValueError('size of the data is not a multiple of the value size')
+    return struct.unpack('<%d%s' % (len(values) // size, code), values)
+
+
+def read(name):
+    content = open(name, 'rb').read()
+    split = content.find(b'<AppendedData')
+    if split < 0:
+        root = ET.fromstring(content.split(b'-->', 1)[1])
+        return root, [(a, [float(v) for v in a.text.split()]) for a in root.iter('DataArray')]
+    root = ET.fromstring(content[:split].split(b'-->', 1)[1] + b'</VTKFile>')
+    appended = content[split:]
+    encoding = appended[:appended.find(b'>')].split(b'"')[1]
+    data = appended[appended.find(b'_') + 1:appended.rfind(b'\n</AppendedData>')]
+    if encoding == b'base64':
+        data = data.decode('ascii')
+    return root, [(a, decode(a, root, data, encoding == b'raw')) for a in root.iter('DataArray')]
+
+
+err = 0
+for f in sys.argv[1:]:
+    name = f.split(':')[0]
+    for suffix in files:
+        ref = read('vtkxmlformats01.out.' + suffix)[1]
+        fname = 'vtkxmlformats01.%s.out.%s' % (name, suffix)
+        print('Comparing ' + fname)
+        try:
+            root, got = read(fname)
+        except Exception as e:
+            print('Check failed: %s cannot be decoded (%s)' % (fname, e))
+            err = 1
+            continue
+        if len(got) != len(ref):
+            print('Check failed: %s has %d data arrays instead of %d' % (fname, len(got), len(ref)))
+            err = 1
+            continue
+        for (a, values), (r, expected) in zip(got, ref):
+            label = '%s, array %s' % (fname, r.get('Name', ''))
+            if any(a.get(key) != r.get(key) for key in ('type', 'Name', 'NumberOfComponents')):
+                print('Check failed: %s, attributes differ' % label)
+                err = 1
+            elif a.get('format') != 'appended' or len(values) != len(expected):
+                print('Check failed: %s, %d values instead of %d' % (label, len(values), len(expected)))
+                err = 1
+            elif any(abs(v - e) > 1.e-12 + 1.e-6 * abs(e) for v, e in zip(values, expected)):
+                print('Check failed: %s, values differ' % label)
+                err = 1
+sys.exit(err)
+EOF